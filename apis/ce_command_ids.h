@@ -0,0 +1,64 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_command_ids.h
+ * @brief Auto-generated command ID definitions based on YAML configuration.
+ *
+ * This header defines unique 32-bit hashes for each command supported by the
+ * Command Engine. These hashes are used internally for efficient command
+ * identification and dispatch.
+ *
+ * @note This file is auto-generated. Do not modify manually as changes
+ *       will be overwritten by the code generator.
+ */
+
+#ifndef CE_COMMAND_IDS_H
+#define CE_COMMAND_IDS_H
+
+#include <stdint.h>
+
+typedef enum {
+    CE_CMD_CAT_STRING_e              = 0x9C507D33u,
+    CE_CMD_CAT_BYTE_e                = 0x197EF230u,
+    CE_CMD_CAT_BYTES_e               = 0x495D38A3u,
+    CE_CMD_VOID_e                    = 0x7C9FAA57u,
+    CE_CMD_SLOW_WORK_e               = 0x6ED997CCu,
+    CE_CMD_CAL_SET_e                 = 0xB2A1E620u,
+    CE_CMD_CAT_MIXED_e               = 0x4A1B9113u,
+} ce_cmd_hash_et;
+
+/* Number of commands in the generated signature table */
+#define CE_CMD_COUNT (7u)
+
+/* The generator verified that no two command names across all merged
+ * YAML inputs share a DJB2 hash, so the dispatcher may match on the
+ * 32-bit hash alone — no runtime name comparison is needed.
+ */
+#define CE_TABLE_COLLISION_FREE (1u)
+
+/* Per-command hash constants for compile-time special-casing */
+#define CE_HASH_CAT_STRING               0x9C507D33u
+#define CE_HASH_CAT_BYTE                 0x197EF230u
+#define CE_HASH_CAT_BYTES                0x495D38A3u
+#define CE_HASH_VOID                     0x7C9FAA57u
+#define CE_HASH_SLOW_WORK                0x6ED997CCu
+#define CE_HASH_CAL_SET                  0xB2A1E620u
+#define CE_HASH_CAT_MIXED                0x4A1B9113u
+
+/* Build-time hash drift detection: unrolled DJB2 over a probe
+ * command name must match the generator-computed value.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define CE_DJB2_STEP(h, c) \
+    ((((uint32_t)(h) << 5) + (uint32_t)(h)) + (uint32_t)(c))
+/* C++ translation units (unit tests) lack _Static_assert */
+#if defined(__cplusplus)
+static_assert(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(5381u, 'c'), 'a'), 't'), '_'), 's'), 't'), 'r'), 'i'), 'n'), 'g') == 0x9C507D33u,
+              "DJB2 hash drift between generator and runtime (probe: cat_string)");
+#else
+_Static_assert(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(CE_DJB2_STEP(5381u, 'c'), 'a'), 't'), '_'), 's'), 't'), 'r'), 'i'), 'n'), 'g') == 0x9C507D33u,
+               "DJB2 hash drift between generator and runtime (probe: cat_string)");
+#endif
+#undef CE_DJB2_STEP
+#endif
+
+#endif /* CE_COMMAND_IDS_H */
@@ -0,0 +1,25 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_config.h
+ * @brief Auto-generated engine limits from YAML definitions.
+ *
+ * Sizes the dispatcher's buffer constants per project: explicit
+ * values come from the YAML 'limits:' section, while MAX_TOKENS
+ * defaults to the widest command declared in the input, so each
+ * deployment pays exactly the RAM it needs.
+ *
+ * Included by ce_types.h when present; constants left undefined
+ * here fall back to the defaults in ce_types.h.
+ *
+ * @note This file is auto-generated. Do not modify manually as changes
+ *       will be overwritten by the code generator.
+ */
+
+#ifndef CE_CONFIG_H
+#define CE_CONFIG_H
+
+#define MAX_TOKENS (8U)  /* computed: widest command + args */
+#define MAX_ARG_CONTENT_SIZE (64U)  /* default */
+#define MAX_LINE_BUF_SIZE (256U)  /* default */
+
+#endif /* CE_CONFIG_H */
@@ -0,0 +1,193 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_exec.c
+ * @brief Auto-generated fused parse-and-invoke functions from YAML definitions.
+ *
+ * Each `ce_exec_<command>()` function inlines the exact parse call
+ * sequence for its command's argument types and calls the handler
+ * directly, avoiding the per-argument type switch and the
+ * `ce_arg_value_ut` marshalling of the generic path.
+ *
+ * @note This file is auto-generated. Do not modify manually as changes
+ *       will be overwritten by the code generator.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ce_types.h"
+#include "parser_utils.h"
+#include "ce_scheduler.h"
+
+#include "demo.h"
+
+/**
+ * @brief Fused parse-and-invoke for command 'cat_string'.
+ *
+ * @param tokens_apc Token array (command name at [0], arguments after).
+ * @return true if all arguments parsed and the handler succeeded.
+ */
+bool ce_exec_cat_string(char *tokens_apc[])
+{
+    const char* arg0;
+
+    arg0 = tokens_apc[1];
+    if (NULL == arg0)
+    {
+        return false;
+    }
+
+    return demo_cat_string(arg0);
+}
+
+/**
+ * @brief Fused parse-and-invoke for command 'cat_byte'.
+ *
+ * @param tokens_apc Token array (command name at [0], arguments after).
+ * @return true if all arguments parsed and the handler succeeded.
+ */
+bool ce_exec_cat_byte(char *tokens_apc[])
+{
+    uint8_t arg0;
+
+    if (!parse_u8(tokens_apc[1], &arg0))
+    {
+        return false;
+    }
+
+    return demo_cat_byte(arg0);
+}
+
+/**
+ * @brief Fused parse-and-invoke for command 'cat_bytes'.
+ *
+ * @param tokens_apc Token array (command name at [0], arguments after).
+ * @return true if all arguments parsed and the handler succeeded.
+ */
+bool ce_exec_cat_bytes(char *tokens_apc[])
+{
+    uint8_t blob_storage_ua[MAX_ARG_CONTENT_SIZE];
+    size_t blob_used = 0u;
+    size_t blob_len = 0u;
+    const uint8_t* arg0;
+    uint8_t arg1;
+
+    if (!parse_hex_string(tokens_apc[1], &blob_storage_ua[blob_used],
+                          sizeof(blob_storage_ua) - blob_used, &blob_len))
+    {
+        return false;
+    }
+    arg0 = &blob_storage_ua[blob_used];
+    blob_used += blob_len;
+
+    if (!parse_u8(tokens_apc[2], &arg1))
+    {
+        return false;
+    }
+
+    return demo_cat_bytes(arg0, arg1);
+}
+
+/**
+ * @brief Fused parse-and-invoke for command 'void'.
+ *
+ * @param tokens_apc Token array (command name at [0], arguments after).
+ * @return true if all arguments parsed and the handler succeeded.
+ */
+bool ce_exec_void(char *tokens_apc[])
+{
+    (void)tokens_apc;
+    return demo_void();
+}
+
+/**
+ * @brief Fused parse-and-invoke for command 'slow_work'.
+ *
+ * @param tokens_apc Token array (command name at [0], arguments after).
+ * @return true if all arguments parsed and the handler succeeded.
+ */
+bool ce_exec_slow_work(char *tokens_apc[])
+{
+    uint8_t arg0;
+
+    if (!parse_u8(tokens_apc[1], &arg0))
+    {
+        return false;
+    }
+
+    ce_long_status_et status_e = demo_slow_work(arg0);
+
+    if (CE_LONG_CONTINUE_e == status_e)
+    {
+        return ce_scheduler_defer(demo_slow_work_resume);
+    }
+
+    return (CE_LONG_DONE_e == status_e);
+}
+
+/**
+ * @brief Fused parse-and-invoke for command 'cat_mixed'.
+ *
+ * @param tokens_apc Token array (command name at [0], arguments after).
+ * @return true if all arguments parsed and the handler succeeded.
+ */
+bool ce_exec_cat_mixed(char *tokens_apc[])
+{
+    uint8_t blob_storage_ua[MAX_ARG_CONTENT_SIZE];
+    size_t blob_used = 0u;
+    size_t blob_len = 0u;
+    const uint8_t* arg0;
+    const uint8_t* arg1;
+    const char* arg2;
+    const char* arg3;
+    const uint8_t* arg4;
+    int64_t arg5;
+    uint32_t arg6;
+
+    if (!parse_hex_string(tokens_apc[1], &blob_storage_ua[blob_used],
+                          sizeof(blob_storage_ua) - blob_used, &blob_len))
+    {
+        return false;
+    }
+    arg0 = &blob_storage_ua[blob_used];
+    blob_used += blob_len;
+
+    if (!parse_hex_string(tokens_apc[2], &blob_storage_ua[blob_used],
+                          sizeof(blob_storage_ua) - blob_used, &blob_len))
+    {
+        return false;
+    }
+    arg1 = &blob_storage_ua[blob_used];
+    blob_used += blob_len;
+
+    arg2 = tokens_apc[3];
+    if (NULL == arg2)
+    {
+        return false;
+    }
+
+    arg3 = tokens_apc[4];
+    if (NULL == arg3)
+    {
+        return false;
+    }
+
+    if (!parse_hex_string(tokens_apc[5], &blob_storage_ua[blob_used],
+                          sizeof(blob_storage_ua) - blob_used, &blob_len))
+    {
+        return false;
+    }
+    arg4 = &blob_storage_ua[blob_used];
+    blob_used += blob_len;
+
+    if (!parse_i64(tokens_apc[6], &arg5))
+    {
+        return false;
+    }
+
+    if (!parse_u32(tokens_apc[7], &arg6))
+    {
+        return false;
+    }
+
+    return demo_cat_mixed(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_frame_layout.h
+ * @brief Auto-generated binary frame layout constants per command.
+ *
+ * A frame is: [u32 command hash, little-endian] followed by the
+ * arguments in signature order. Integers are raw little-endian at
+ * natural width, bool is one byte, and strings/blobs are a u8
+ * length prefix followed by raw bytes. See inc/ce_frame.h for the
+ * decoding rules.
+ *
+ * @note This file is auto-generated. Do not modify manually as changes
+ *       will be overwritten by the code generator.
+ */
+
+#ifndef CE_FRAME_LAYOUT_H
+#define CE_FRAME_LAYOUT_H
+
+#define CE_FRAME_HASH_SIZE (4u)
+
+/* cat_string: hash u8len+bytes */
+#define CE_FRAME_CAT_STRING_HASH     (0x9C507D33u)
+#define CE_FRAME_CAT_STRING_ARGC     (1u)
+#define CE_FRAME_CAT_STRING_MIN_SIZE (5u)
+
+/* cat_byte: hash le8 */
+#define CE_FRAME_CAT_BYTE_HASH     (0x197EF230u)
+#define CE_FRAME_CAT_BYTE_ARGC     (1u)
+#define CE_FRAME_CAT_BYTE_MIN_SIZE (5u)
+
+/* cat_bytes: hash u8len+bytes le8 */
+#define CE_FRAME_CAT_BYTES_HASH     (0x495D38A3u)
+#define CE_FRAME_CAT_BYTES_ARGC     (2u)
+#define CE_FRAME_CAT_BYTES_MIN_SIZE (6u)
+
+/* void: hash (no arguments) */
+#define CE_FRAME_VOID_HASH     (0x7C9FAA57u)
+#define CE_FRAME_VOID_ARGC     (0u)
+#define CE_FRAME_VOID_MIN_SIZE (4u)
+
+/* slow_work: hash le8 */
+#define CE_FRAME_SLOW_WORK_HASH     (0x6ED997CCu)
+#define CE_FRAME_SLOW_WORK_ARGC     (1u)
+#define CE_FRAME_SLOW_WORK_MIN_SIZE (5u)
+
+/* cal_set: vectored command, no frame layout */
+
+/* cat_mixed: hash u8len+bytes u8len+bytes u8len+bytes u8len+bytes u8len+bytes le64 le32 */
+#define CE_FRAME_CAT_MIXED_HASH     (0x4A1B9113u)
+#define CE_FRAME_CAT_MIXED_ARGC     (7u)
+#define CE_FRAME_CAT_MIXED_MIN_SIZE (21u)
+
+#endif /* CE_FRAME_LAYOUT_H */
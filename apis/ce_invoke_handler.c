@@ -0,0 +1,85 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_invoke_handler.c
+ * @brief Auto-generated command invocation handler from YAML definitions.
+ *
+ * This source file implements the `invoke_handler()` function, which
+ * dispatches commands to their respective handler functions based on
+ * command hash values and associated argument type information.
+ *
+ * @note This file is auto-generated. Do not modify manually as changes
+ *       will be overwritten by the code generator.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "ce_types.h"
+#include "ce_command_ids.h"
+#include "ce_scheduler.h"
+
+#include "demo.h"
+
+bool ce_invoke_handler(const ce_signature_st *sig_pst,
+                       const ce_arg_value_ut args_a[MAX_TOKENS],
+                       uint8_t arg_count_u8)
+{
+    (void)arg_count_u8;  /* used by vectored commands only */
+
+    switch ((ce_cmd_hash_et)sig_pst->hash_u32)
+    {
+        case CE_CMD_CAT_STRING_e:
+            return ((bool (*)(const char*))sig_pst->handler)(
+                (const char*)ARGVAL(sig_pst->types_e[0], args_a[0])
+            );
+        case CE_CMD_CAT_BYTE_e:
+            return ((bool (*)(uint8_t))sig_pst->handler)(
+                (uint8_t)ARGVAL(sig_pst->types_e[0], args_a[0])
+            );
+        case CE_CMD_CAT_BYTES_e:
+            return ((bool (*)(const uint8_t*, uint8_t))sig_pst->handler)(
+                (const uint8_t*)ARGVAL(sig_pst->types_e[0], args_a[0]),
+                (uint8_t)ARGVAL(sig_pst->types_e[1], args_a[1])
+            );
+        case CE_CMD_VOID_e:
+            return ((bool (*)(void))sig_pst->handler)();
+        case CE_CMD_SLOW_WORK_e:
+        {
+            ce_long_status_et status_e = ((ce_long_status_et (*)(uint8_t))sig_pst->handler)(
+                (uint8_t)ARGVAL(sig_pst->types_e[0], args_a[0])
+            );
+            if (CE_LONG_CONTINUE_e == status_e)
+            {
+                return ce_scheduler_defer(demo_slow_work_resume);
+            }
+            return (CE_LONG_DONE_e == status_e);
+        }
+        case CE_CMD_CAL_SET_e:
+        {
+            uint16_t vec_a[MAX_TOKENS];
+            uint8_t vec_count_u8 = (uint8_t)(arg_count_u8 - 1u);
+
+            for (uint8_t i = 0u; i < vec_count_u8; ++i)
+            {
+                vec_a[i] = (uint16_t)ARGVAL(sig_pst->types_e[1], args_a[1u + i]);
+            }
+
+            return ((bool (*)(uint8_t, const uint16_t *, uint8_t))sig_pst->handler)(
+                (uint8_t)ARGVAL(sig_pst->types_e[0], args_a[0]),
+                vec_a,
+                vec_count_u8
+            );
+        }
+        case CE_CMD_CAT_MIXED_e:
+            return ((bool (*)(const uint8_t*, const uint8_t*, const char*, const char*, const uint8_t*, int64_t, uint32_t))sig_pst->handler)(
+                (const uint8_t*)ARGVAL(sig_pst->types_e[0], args_a[0]),
+                (const uint8_t*)ARGVAL(sig_pst->types_e[1], args_a[1]),
+                (const char*)ARGVAL(sig_pst->types_e[2], args_a[2]),
+                (const char*)ARGVAL(sig_pst->types_e[3], args_a[3]),
+                (const uint8_t*)ARGVAL(sig_pst->types_e[4], args_a[4]),
+                (int64_t)ARGVAL(sig_pst->types_e[5], args_a[5]),
+                (uint32_t)ARGVAL(sig_pst->types_e[6], args_a[6])
+            );
+        default:
+            return false;
+    }
+}
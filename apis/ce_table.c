@@ -0,0 +1,271 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_table.c
+ * @brief Auto-generated dispatch table for command handlers.
+ *
+ * This file contains the command signature table generated from the
+ * YAML configuration. It defines command hashes, their associated
+ * handler functions, and argument type signatures.
+ *
+ * The table is emitted sorted by ascending hash value, which allows
+ * `ce_table_lookup_hash()` to resolve a command in O(log n) with a
+ * lower-bound binary search instead of a linear scan. The search runs
+ * over a dense parallel `uint32_t` hash array (16 hashes per cache
+ * line) so the cold signature entries — handler pointers and type
+ * arrays — are only touched after the match.
+ *
+ * It also provides accessor functions to retrieve the command signatures
+ * at runtime.
+ *
+ * @note This file is auto-generated. Do not modify manually as changes
+ *       will be overwritten by the code generator.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ce_table.h"
+#include "ce_command_ids.h"
+
+#include "demo.h"
+
+/* Compile-time type checking for function signatures */
+#if defined(__GNUC__) || defined(__clang__)
+#define CE_ASSERT_ARGS(fn, ...)                  \
+    _Static_assert(__builtin_types_compatible_p( \
+        typeof(&(fn)), bool (*)(__VA_ARGS__)     \
+    ), "Signature mismatch: " #fn)
+/* long_running handlers return ce_long_status_et instead of bool */
+#define CE_ASSERT_ARGS_LONG(fn, ...)                      \
+    _Static_assert(__builtin_types_compatible_p(          \
+        typeof(&(fn)), ce_long_status_et (*)(__VA_ARGS__) \
+    ), "Signature mismatch: " #fn)
+#else
+#warning "CE_ASSERT_ARGS: function signature checks not available on this compiler!"
+#define CE_ASSERT_ARGS(fn, ...)
+#define CE_ASSERT_ARGS_LONG(fn, ...)
+#endif
+
+CE_ASSERT_ARGS(demo_cat_byte, uint8_t);
+CE_ASSERT_ARGS(demo_cat_bytes, const uint8_t*, uint8_t);
+CE_ASSERT_ARGS(demo_cat_mixed, const uint8_t*, const uint8_t*, const char*, const char*, const uint8_t*, int64_t, uint32_t);
+CE_ASSERT_ARGS_LONG(demo_slow_work, uint8_t);
+CE_ASSERT_ARGS(demo_void, void);
+CE_ASSERT_ARGS(demo_cat_string, const char*);
+CE_ASSERT_ARGS(demo_cal_set, uint8_t, const uint16_t *, uint8_t);
+
+/* Fused parse-and-invoke entry points (defined in ce_exec.c).
+ * Vectored commands have none: only the generic path carries the
+ * runtime token count their handlers need.
+ */
+bool ce_exec_cat_byte(char *tokens_apc[]);
+bool ce_exec_cat_bytes(char *tokens_apc[]);
+bool ce_exec_cat_mixed(char *tokens_apc[]);
+bool ce_exec_slow_work(char *tokens_apc[]);
+bool ce_exec_void(char *tokens_apc[]);
+bool ce_exec_cat_string(char *tokens_apc[]);
+
+static const ce_arg_type_et ce_args_cat_byte_ae[] = {
+    TYPE_UINT8_e
+};
+
+static const ce_arg_type_et ce_args_cat_bytes_ae[] = {
+    TYPE_UINT8_PTR_e, TYPE_UINT8_e
+};
+
+static const ce_arg_type_et ce_args_cat_mixed_ae[] = {
+    TYPE_UINT8_PTR_e, TYPE_UINT8_PTR_e, TYPE_STRING_e, TYPE_STRING_e, TYPE_UINT8_PTR_e, TYPE_INT64_e, TYPE_UINT32_e
+};
+
+static const ce_arg_type_et ce_args_slow_work_ae[] = {
+    TYPE_UINT8_e
+};
+
+static const ce_arg_type_et ce_args_void_ae[] = {
+};
+
+static const ce_arg_type_et ce_args_cat_string_ae[] = {
+    TYPE_STRING_e
+};
+
+static const ce_arg_type_et ce_args_cal_set_ae[] = {
+    TYPE_UINT8_e, TYPE_UINT16_e
+};
+
+/* Command names sorted lexicographically for prefix lookup */
+static const char *const ce_command_names_apc[] = {
+    "cal_set",
+    "cat_byte",
+    "cat_bytes",
+    "cat_mixed",
+    "cat_string",
+    "slow_work",
+    "void",
+};
+
+/* Dense hash index scanned alone during lookup (SoA hot column) */
+static const uint32_t ce_command_hashes_ua[] = {
+    0x197EF230u,  /* cat_byte */
+    0x495D38A3u,  /* cat_bytes */
+    0x4A1B9113u,  /* cat_mixed */
+    0x6ED997CCu,  /* slow_work */
+    0x7C9FAA57u,  /* void */
+    0x9C507D33u,  /* cat_string */
+    0xB2A1E620u,  /* cal_set */
+};
+
+static const ce_signature_st ce_signature_table_ast[] = {
+    {
+        .hash_u32 = 0x197EF230u,
+        .handler = (handler_func_t)demo_cat_byte,
+        .exec_fn = ce_exec_cat_byte,
+        .types_e = ce_args_cat_byte_ae,
+        .type_count_u8 = 1u
+    },
+    {
+        .hash_u32 = 0x495D38A3u,
+        .handler = (handler_func_t)demo_cat_bytes,
+        .exec_fn = ce_exec_cat_bytes,
+        .types_e = ce_args_cat_bytes_ae,
+        .type_count_u8 = 2u
+    },
+    {
+        .hash_u32 = 0x4A1B9113u,
+        .handler = (handler_func_t)demo_cat_mixed,
+        .exec_fn = ce_exec_cat_mixed,
+        .types_e = ce_args_cat_mixed_ae,
+        .type_count_u8 = 7u
+    },
+    {
+        .hash_u32 = 0x6ED997CCu,
+        .handler = (handler_func_t)demo_slow_work,
+        .exec_fn = ce_exec_slow_work,
+        .types_e = ce_args_slow_work_ae,
+        .type_count_u8 = 1u
+    },
+    {
+        .hash_u32 = 0x7C9FAA57u,
+        .handler = (handler_func_t)demo_void,
+        .exec_fn = ce_exec_void,
+        .types_e = ce_args_void_ae,
+        .type_count_u8 = 0u
+    },
+    {
+        .hash_u32 = 0x9C507D33u,
+        .handler = (handler_func_t)demo_cat_string,
+        .exec_fn = ce_exec_cat_string,
+        .types_e = ce_args_cat_string_ae,
+        .type_count_u8 = 1u
+    },
+    {
+        .hash_u32 = 0xB2A1E620u,
+        .handler = (handler_func_t)demo_cal_set,
+        .exec_fn = NULL,
+        .types_e = ce_args_cal_set_ae,
+        .type_count_u8 = 2u,
+        .repeat_min_u8 = 1u,
+        .repeat_max_u8 = (uint8_t)(MAX_TOKENS - 2u)
+    },
+};
+
+const ce_signature_st* ce_table_get_signatures(void)
+{
+    return ce_signature_table_ast;
+}
+
+size_t ce_table_get_signatures_count(void)
+{
+    return sizeof(ce_signature_table_ast) / sizeof(ce_signature_table_ast[0]);
+}
+
+const char *const *ce_table_get_names(void)
+{
+    return ce_command_names_apc;
+}
+
+size_t ce_table_find_prefix(const char *prefix_cp, size_t *first_idx_p)
+{
+    size_t count = sizeof(ce_command_names_apc) / sizeof(ce_command_names_apc[0]);
+    size_t prefix_len;
+    size_t lo;
+    size_t hi;
+    size_t first;
+
+    if ((NULL == prefix_cp) || (NULL == first_idx_p))
+    {
+        return 0u;
+    }
+
+    prefix_len = strlen(prefix_cp);
+
+    /* First binary search: lowest name not lexicographically below
+     * the prefix.
+     */
+    lo = 0u;
+    hi = count;
+    while (lo < hi)
+    {
+        size_t mid = lo + ((hi - lo) / 2u);
+
+        if (strncmp(ce_command_names_apc[mid], prefix_cp, prefix_len) < 0)
+        {
+            lo = mid + 1u;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    first = lo;
+
+    /* Second binary search: first name past the prefix range */
+    hi = count;
+    while (lo < hi)
+    {
+        size_t mid = lo + ((hi - lo) / 2u);
+
+        if (strncmp(ce_command_names_apc[mid], prefix_cp, prefix_len) <= 0)
+        {
+            lo = mid + 1u;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    *first_idx_p = first;
+    return lo - first;
+}
+
+const ce_signature_st* ce_table_lookup_hash(uint32_t hash_u32)
+{
+    size_t lo = 0u;
+    size_t hi = sizeof(ce_command_hashes_ua) / sizeof(ce_command_hashes_ua[0]);
+
+    /* Lower-bound search over the dense hash array only; the cold
+     * signature entry is indexed once at the match position.
+     */
+    while (lo < hi)
+    {
+        size_t mid = lo + ((hi - lo) / 2u);
+
+        if (ce_command_hashes_ua[mid] < hash_u32)
+        {
+            lo = mid + 1u;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if ((lo < (sizeof(ce_command_hashes_ua) / sizeof(ce_command_hashes_ua[0]))) &&
+        (ce_command_hashes_ua[lo] == hash_u32))
+    {
+        return &ce_signature_table_ast[lo];
+    }
+
+    return NULL;
+}
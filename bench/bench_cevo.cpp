@@ -0,0 +1,163 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file bench_cevo.cpp
+ * @brief Google Benchmark harnesses for the command engine hot paths.
+ *
+ * Covers end-to-end dispatch, hashing, hex decoding, tokenization, and
+ * hash-to-signature lookup across table sizes of 10/100/1000 entries.
+ * Throughput is reported as items/sec so releases can be gated on
+ * commands/sec alongside ns/op.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+extern "C" {
+#include "ce_dispatch.h"
+#include "ce_hash.h"
+#include "ce_table.h"
+#include "parser_utils.h"
+#include "demo.h"
+}
+
+// -----------------------------------------------------------------------------
+// Demo handler stubs (the generated table references them)
+// -----------------------------------------------------------------------------
+
+extern "C" bool demo_cat_string(const char*) { return true; }
+extern "C" bool demo_cat_byte(uint8_t) { return true; }
+extern "C" bool demo_cat_bytes(const uint8_t*, uint8_t) { return true; }
+extern "C" bool demo_void(void) { return true; }
+extern "C" bool demo_cat_mixed(const uint8_t*, const uint8_t*, const char*,
+                               const char*, const uint8_t*, int64_t, uint32_t) {
+    return true;
+}
+extern "C" bool demo_cal_set(uint8_t, const uint16_t*, uint8_t) { return true; }
+extern "C" ce_long_status_et demo_slow_work(uint8_t) { return CE_LONG_DONE_e; }
+extern "C" ce_long_status_et demo_slow_work_resume(void) { return CE_LONG_DONE_e; }
+
+// -----------------------------------------------------------------------------
+// End-to-end dispatch
+// -----------------------------------------------------------------------------
+
+static void BM_DispatchFromLine_Scalar(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ce_dispatch_from_line("cat_byte 42"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DispatchFromLine_Scalar);
+
+static void BM_DispatchFromLine_HexHeavy(benchmark::State& state) {
+    // 32-byte payload: a typical firmware-chunk style command
+    std::string line = "cat_bytes ";
+    for (int i = 0; i < 32; ++i) line += "AB";
+    line += " 32";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ce_dispatch_from_line(line.c_str()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DispatchFromLine_HexHeavy);
+
+static void BM_DispatchFromLine_Inplace(benchmark::State& state) {
+    const char kLine[] = "cat_byte 42";
+    char buf[sizeof(kLine)];
+    for (auto _ : state) {
+        std::memcpy(buf, kLine, sizeof(kLine));
+        benchmark::DoNotOptimize(ce_dispatch_from_line_inplace(buf, sizeof(kLine) - 1));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DispatchFromLine_Inplace);
+
+// -----------------------------------------------------------------------------
+// Hashing
+// -----------------------------------------------------------------------------
+
+static void BM_HashCalculate(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ce_hash_calculate("cat_mixed"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HashCalculate);
+
+// -----------------------------------------------------------------------------
+// Hex decoding
+// -----------------------------------------------------------------------------
+
+static void BM_ParseHexString(benchmark::State& state) {
+    const size_t bytes = static_cast<size_t>(state.range(0));
+    std::string hex(bytes * 2, 'A');
+    std::vector<uint8_t> out(bytes);
+    size_t out_len = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_hex_string(hex.c_str(), out.data(), out.size(), &out_len));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+}
+BENCHMARK(BM_ParseHexString)->Arg(8)->Arg(32)->Arg(64);
+
+// -----------------------------------------------------------------------------
+// Tokenization (exercised through the in-place entry point: tokenize cost
+// dominates for a line with an unknown command, since lookup fails fast)
+// -----------------------------------------------------------------------------
+
+static void BM_Tokenize_LongLine(benchmark::State& state) {
+    std::string line = "zzz_unknown";
+    while (line.size() < MAX_LINE_BUF_SIZE - 20) line += " tokentokentoken";
+    std::vector<char> buf(line.size() + 1);
+    for (auto _ : state) {
+        std::memcpy(buf.data(), line.c_str(), line.size() + 1);
+        benchmark::DoNotOptimize(ce_dispatch_from_line_inplace(buf.data(), line.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(line.size()));
+}
+BENCHMARK(BM_Tokenize_LongLine);
+
+// -----------------------------------------------------------------------------
+// Hash-to-signature lookup
+//
+// The real generated table is benchmarked directly; scaling behavior across
+// 10/100/1000 entries is modeled with synthetic hash-sorted tables run
+// through the same lower-bound binary search the generator emits.
+// -----------------------------------------------------------------------------
+
+static void BM_TableLookup_Generated(benchmark::State& state) {
+    const uint32_t hash = ce_hash_calculate("cat_mixed");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ce_table_lookup_hash(hash));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TableLookup_Generated);
+
+static size_t lower_bound_lookup(const std::vector<uint32_t>& hashes, uint32_t hash) {
+    size_t lo = 0, hi = hashes.size();
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (hashes[mid] < hash) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+static void BM_TableLookup_Synthetic(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::vector<uint32_t> hashes(count);
+    for (size_t i = 0; i < count; ++i) {
+        hashes[i] = ce_hash_calculate(("cmd_" + std::to_string(i)).c_str());
+    }
+    std::sort(hashes.begin(), hashes.end());
+    const uint32_t probe = hashes[count / 2];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lower_bound_lookup(hashes, probe));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TableLookup_Synthetic)->Arg(10)->Arg(100)->Arg(1000);
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/apis/ce_exec.c" "CMakeFiles/cevo.dir/apis/ce_exec.c.o" "gcc" "CMakeFiles/cevo.dir/apis/ce_exec.c.o.d"
+  "/root/repo/apis/ce_invoke_handler.c" "CMakeFiles/cevo.dir/apis/ce_invoke_handler.c.o" "gcc" "CMakeFiles/cevo.dir/apis/ce_invoke_handler.c.o.d"
+  "/root/repo/apis/ce_table.c" "CMakeFiles/cevo.dir/apis/ce_table.c.o" "gcc" "CMakeFiles/cevo.dir/apis/ce_table.c.o.d"
+  "/root/repo/src/ce_ctx.c" "CMakeFiles/cevo.dir/src/ce_ctx.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_ctx.c.o.d"
+  "/root/repo/src/ce_dispatch.c" "CMakeFiles/cevo.dir/src/ce_dispatch.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_dispatch.c.o.d"
+  "/root/repo/src/ce_frame.c" "CMakeFiles/cevo.dir/src/ce_frame.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_frame.c.o.d"
+  "/root/repo/src/ce_hash.c" "CMakeFiles/cevo.dir/src/ce_hash.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_hash.c.o.d"
+  "/root/repo/src/ce_out.c" "CMakeFiles/cevo.dir/src/ce_out.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_out.c.o.d"
+  "/root/repo/src/ce_queue.c" "CMakeFiles/cevo.dir/src/ce_queue.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_queue.c.o.d"
+  "/root/repo/src/ce_scheduler.c" "CMakeFiles/cevo.dir/src/ce_scheduler.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_scheduler.c.o.d"
+  "/root/repo/src/ce_shm.c" "CMakeFiles/cevo.dir/src/ce_shm.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_shm.c.o.d"
+  "/root/repo/src/ce_stats.c" "CMakeFiles/cevo.dir/src/ce_stats.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_stats.c.o.d"
+  "/root/repo/src/ce_stream.c" "CMakeFiles/cevo.dir/src/ce_stream.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_stream.c.o.d"
+  "/root/repo/src/ce_table_registry.c" "CMakeFiles/cevo.dir/src/ce_table_registry.c.o" "gcc" "CMakeFiles/cevo.dir/src/ce_table_registry.c.o.d"
+  "/root/repo/src/logger.c" "CMakeFiles/cevo.dir/src/logger.c.o" "gcc" "CMakeFiles/cevo.dir/src/logger.c.o.d"
+  "/root/repo/src/parser_utils.c" "CMakeFiles/cevo.dir/src/parser_utils.c.o" "gcc" "CMakeFiles/cevo.dir/src/parser_utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cevo.dir/apis/ce_exec.c.o"
+  "CMakeFiles/cevo.dir/apis/ce_exec.c.o.d"
+  "CMakeFiles/cevo.dir/apis/ce_invoke_handler.c.o"
+  "CMakeFiles/cevo.dir/apis/ce_invoke_handler.c.o.d"
+  "CMakeFiles/cevo.dir/apis/ce_table.c.o"
+  "CMakeFiles/cevo.dir/apis/ce_table.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_ctx.c.o"
+  "CMakeFiles/cevo.dir/src/ce_ctx.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_dispatch.c.o"
+  "CMakeFiles/cevo.dir/src/ce_dispatch.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_frame.c.o"
+  "CMakeFiles/cevo.dir/src/ce_frame.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_hash.c.o"
+  "CMakeFiles/cevo.dir/src/ce_hash.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_out.c.o"
+  "CMakeFiles/cevo.dir/src/ce_out.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_queue.c.o"
+  "CMakeFiles/cevo.dir/src/ce_queue.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_scheduler.c.o"
+  "CMakeFiles/cevo.dir/src/ce_scheduler.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_shm.c.o"
+  "CMakeFiles/cevo.dir/src/ce_shm.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_stats.c.o"
+  "CMakeFiles/cevo.dir/src/ce_stats.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_stream.c.o"
+  "CMakeFiles/cevo.dir/src/ce_stream.c.o.d"
+  "CMakeFiles/cevo.dir/src/ce_table_registry.c.o"
+  "CMakeFiles/cevo.dir/src/ce_table_registry.c.o.d"
+  "CMakeFiles/cevo.dir/src/logger.c.o"
+  "CMakeFiles/cevo.dir/src/logger.c.o.d"
+  "CMakeFiles/cevo.dir/src/parser_utils.c.o"
+  "CMakeFiles/cevo.dir/src/parser_utils.c.o.d"
+  "libcevo.a"
+  "libcevo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cevo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Test".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "GTest::gmock" for configuration "Test"
+set_property(TARGET GTest::gmock APPEND PROPERTY IMPORTED_CONFIGURATIONS TEST)
+set_target_properties(GTest::gmock PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_TEST "CXX"
+  IMPORTED_LOCATION_TEST "${_IMPORT_PREFIX}/lib/libgmock.a"
+  )
+
+list(APPEND _cmake_import_check_targets GTest::gmock )
+list(APPEND _cmake_import_check_files_for_GTest::gmock "${_IMPORT_PREFIX}/lib/libgmock.a" )
+
+# Import target "GTest::gmock_main" for configuration "Test"
+set_property(TARGET GTest::gmock_main APPEND PROPERTY IMPORTED_CONFIGURATIONS TEST)
+set_target_properties(GTest::gmock_main PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_TEST "CXX"
+  IMPORTED_LOCATION_TEST "${_IMPORT_PREFIX}/lib/libgmock_main.a"
+  )
+
+list(APPEND _cmake_import_check_targets GTest::gmock_main )
+list(APPEND _cmake_import_check_files_for_GTest::gmock_main "${_IMPORT_PREFIX}/lib/libgmock_main.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
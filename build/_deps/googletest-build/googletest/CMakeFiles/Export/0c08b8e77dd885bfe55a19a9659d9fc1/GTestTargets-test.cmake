@@ -0,0 +1,29 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Test".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "GTest::gtest" for configuration "Test"
+set_property(TARGET GTest::gtest APPEND PROPERTY IMPORTED_CONFIGURATIONS TEST)
+set_target_properties(GTest::gtest PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_TEST "CXX"
+  IMPORTED_LOCATION_TEST "${_IMPORT_PREFIX}/lib/libgtest.a"
+  )
+
+list(APPEND _cmake_import_check_targets GTest::gtest )
+list(APPEND _cmake_import_check_files_for_GTest::gtest "${_IMPORT_PREFIX}/lib/libgtest.a" )
+
+# Import target "GTest::gtest_main" for configuration "Test"
+set_property(TARGET GTest::gtest_main APPEND PROPERTY IMPORTED_CONFIGURATIONS TEST)
+set_target_properties(GTest::gtest_main PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_TEST "CXX"
+  IMPORTED_LOCATION_TEST "${_IMPORT_PREFIX}/lib/libgtest_main.a"
+  )
+
+list(APPEND _cmake_import_check_targets GTest::gtest_main )
+list(APPEND _cmake_import_check_files_for_GTest::gtest_main "${_IMPORT_PREFIX}/lib/libgtest_main.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/apis/ce_config.h" "/root/repo/apis/ce_command_ids.h"
+  "/root/repo/apis/ce_exec.c" "/root/repo/apis/ce_command_ids.h"
+  "/root/repo/apis/ce_frame_layout.h" "/root/repo/apis/ce_command_ids.h"
+  "/root/repo/apis/ce_invoke_handler.c" "/root/repo/apis/ce_command_ids.h"
+  "/root/repo/apis/ce_table.c" "/root/repo/apis/ce_command_ids.h"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "/root/repo/apis/ce_command_ids.h"
+  "/root/repo/apis/ce_config.h"
+  "/root/repo/apis/ce_exec.c"
+  "/root/repo/apis/ce_frame_layout.h"
+  "/root/repo/apis/ce_invoke_handler.c"
+  "/root/repo/apis/ce_table.c"
+  "CMakeFiles/generate_apis"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/generate_apis.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
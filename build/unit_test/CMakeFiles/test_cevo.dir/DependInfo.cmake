@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/unit_test/test_ctx.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_ctx.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_ctx.cpp.o.d"
+  "/root/repo/unit_test/test_dispatch.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_dispatch.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_dispatch.cpp.o.d"
+  "/root/repo/unit_test/test_frame.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_frame.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_frame.cpp.o.d"
+  "/root/repo/unit_test/test_hash.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_hash.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_hash.cpp.o.d"
+  "/root/repo/unit_test/test_logger.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_logger.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_logger.cpp.o.d"
+  "/root/repo/unit_test/test_out.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_out.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_out.cpp.o.d"
+  "/root/repo/unit_test/test_parser_utils.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_parser_utils.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_parser_utils.cpp.o.d"
+  "/root/repo/unit_test/test_queue.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_queue.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_queue.cpp.o.d"
+  "/root/repo/unit_test/test_registry.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_registry.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_registry.cpp.o.d"
+  "/root/repo/unit_test/test_scheduler.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_scheduler.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_scheduler.cpp.o.d"
+  "/root/repo/unit_test/test_shm.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_shm.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_shm.cpp.o.d"
+  "/root/repo/unit_test/test_stats.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_stats.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_stats.cpp.o.d"
+  "/root/repo/unit_test/test_stream.cpp" "unit_test/CMakeFiles/test_cevo.dir/test_stream.cpp.o" "gcc" "unit_test/CMakeFiles/test_cevo.dir/test_stream.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/build/CMakeFiles/cevo.dir/DependInfo.cmake"
+  "/root/repo/build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cevo.dir/test_ctx.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_ctx.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_dispatch.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_dispatch.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_frame.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_frame.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_hash.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_hash.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_logger.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_logger.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_out.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_out.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_parser_utils.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_parser_utils.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_queue.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_queue.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_registry.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_registry.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_scheduler.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_scheduler.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_shm.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_shm.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_stats.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_stats.cpp.o.d"
+  "CMakeFiles/test_cevo.dir/test_stream.cpp.o"
+  "CMakeFiles/test_cevo.dir/test_stream.cpp.o.d"
+  "test_cevo"
+  "test_cevo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cevo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
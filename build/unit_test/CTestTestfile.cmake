@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unit_test
+# Build directory: /root/repo/build/unit_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_cevo]=] "/root/repo/build/unit_test/test_cevo")
+set_tests_properties([=[test_cevo]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/unit_test/CMakeLists.txt;79;add_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test([=[perf_test]=] "/root/repo/build/unit_test/perf_test")
+set_tests_properties([=[perf_test]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/unit_test/CMakeLists.txt;119;add_test;/root/repo/unit_test/CMakeLists.txt;0;")
+subdirs("../_deps/googletest-build")
@@ -0,0 +1,137 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_ctx.h
+ * @brief Explicit engine context aggregating all per-dispatcher mutable state.
+ *
+ * The signature table is read-only and safely shared, but the log ring,
+ * output ring, stats counters, and lookup cache are mutable — with them as
+ * globals only one dispatcher instance can run. `ce_ctx_st` gathers that
+ * state into one statically allocatable object, so a multi-core gateway
+ * can run one dispatcher per core: give each core its own context (and its
+ * own drain tasks) and dispatch scales without any cross-core sharing.
+ *
+ * Every existing entry point keeps working unchanged: the engine routes
+ * all state access through the *active* context, which starts out as a
+ * built-in default context. The active-context pointer is thread-local
+ * where the compiler supports it, so each core selects its context once
+ * with `ce_ctx_activate()` (or per call with `ce_dispatch_ctx()`) and the
+ * whole API — including `log_drain()` and `ce_out_drain()` — operates on
+ * that core's state.
+ */
+
+#ifndef CE_CTX_H
+#define CE_CTX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include "logger.h"
+#include "ce_out.h"
+#include "ce_stats.h"
+
+#ifdef CE_LOOKUP_CACHE_SIZE
+
+#if (CE_LOOKUP_CACHE_SIZE & (CE_LOOKUP_CACHE_SIZE - 1u)) != 0u
+#error "CE_LOOKUP_CACHE_SIZE must be a power of two"
+#endif
+
+/**
+ * @struct ce_lookup_cache_entry_st
+ * @brief One direct-mapped lookup cache entry (dispatcher-internal).
+ *
+ * An entry is valid when `sig_pst` is non-NULL; hash 0 therefore needs no
+ * special casing. Each context owns its own cache, so entries never move
+ * between cores.
+ */
+typedef struct {
+    uint32_t hash_u32;               /**< Cached command hash */
+    const ce_signature_st *sig_pst;  /**< Resolved signature, NULL if empty */
+} ce_lookup_cache_entry_st;
+
+#endif /* CE_LOOKUP_CACHE_SIZE */
+
+/**
+ * @struct ce_ctx_st
+ * @brief All mutable per-dispatcher state, in one zero-initializable block.
+ *
+ * Statically allocate one per core and activate it from that core's
+ * dispatch thread. A zeroed context is ready for use (static storage needs
+ * no `ce_ctx_init()` call); the layout depends on the same build flags as
+ * the rest of the engine, so all translation units must agree on them.
+ */
+typedef struct {
+    ce_log_state_st log_st;          /**< Binary log ring (see logger.h) */
+    ce_out_state_st out_st;          /**< Handler output ring (see ce_out.h) */
+#ifdef CE_STATS_ENABLE
+    ce_stats_state_st stats_st;      /**< Per-command counters (see ce_stats.h) */
+#endif
+#ifdef CE_LOOKUP_CACHE_SIZE
+    ce_lookup_cache_entry_st lookup_cache_ast[CE_LOOKUP_CACHE_SIZE]; /**< Hash lookup cache */
+#endif
+} ce_ctx_st;
+
+/**
+ * @brief Returns the built-in default context.
+ *
+ * This is the context all engine state lived in before contexts existed;
+ * it is active until a thread selects another one.
+ *
+ * @return Pointer to the default context (never NULL).
+ */
+ce_ctx_st *ce_ctx_default(void);
+
+/**
+ * @brief Returns the calling thread's active context.
+ *
+ * Engine modules route every state access through this; applications can
+ * use it to drain the rings of whatever context is current.
+ *
+ * @return Pointer to the active context (never NULL).
+ */
+ce_ctx_st *ce_ctx_active(void);
+
+/**
+ * @brief Selects the calling thread's active context.
+ *
+ * Typical per-core setup: activate the core's context once at thread
+ * start, then use the regular entry points. Without compiler support for
+ * thread-local storage the selection is process-wide (see ce_ctx.c).
+ *
+ * @param ctx_pst Context to activate, or NULL to select the default.
+ */
+void ce_ctx_activate(ce_ctx_st *ctx_pst);
+
+/**
+ * @brief Resets a context to its pristine (all-zero) state.
+ *
+ * Only needed to recycle a context; fresh static storage is already
+ * zeroed. Must not be called on a context another thread is using.
+ *
+ * @param ctx_pst Context to reset (NULL is ignored).
+ */
+void ce_ctx_init(ce_ctx_st *ctx_pst);
+
+/**
+ * @brief Dispatches one line with an explicit context.
+ *
+ * Activates `ctx_pst` for the duration of the call, runs
+ * `ce_dispatch_from_line()`, and restores the previously active context —
+ * convenient when one thread multiplexes several contexts.
+ *
+ * @param[in] ctx_pst  Context receiving logs/output/stats, or NULL for
+ *                     the default context.
+ * @param[in] line_str Null-terminated command string (not modified).
+ *
+ * @retval true   Dispatch and execution succeeded.
+ * @retval false  Command not found or arguments invalid.
+ */
+bool ce_dispatch_ctx(ce_ctx_st *ctx_pst, const char *line_str);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CE_CTX_H */
@@ -17,6 +17,9 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+
+#include "ce_types.h"
 
 /**
  * @brief Dispatch a command line to the appropriate handler.
@@ -32,6 +35,184 @@ extern "C" {
  */
 bool ce_dispatch_from_line(const char *line_str);
 
+/**
+ * @struct ce_arena_st
+ * @brief Caller-provided bump allocator for binary argument storage.
+ *
+ * Blob (`TYPE_UINT8_PTR_e`) arguments are decoded into `base_u8p` at
+ * increasing offsets; `used` tracks consumption. Reset `used` to 0 to
+ * recycle the arena between dispatches.
+ */
+typedef struct {
+    uint8_t *base_u8p;  /**< Arena storage (caller-owned) */
+    size_t size;        /**< Capacity of `base_u8p` in bytes */
+    size_t used;        /**< Bytes already handed out */
+} ce_arena_st;
+
+/**
+ * @brief Dispatch a command line, decoding blobs into a caller arena.
+ *
+ * Identical to `ce_dispatch_from_line()` except that binary arguments
+ * land in `arena_pst` instead of the internal stack buffer capped at
+ * `MAX_ARG_CONTENT_SIZE` bytes — a gateway can pass a multi-KiB static
+ * arena and push large firmware chunks through a single command while
+ * keeping the zero-malloc guarantee. Line length is still bounded by
+ * `MAX_LINE_BUF_SIZE`.
+ *
+ * @param[in]     line_str  Null-terminated command string (not modified).
+ * @param[in,out] arena_pst Arena receiving decoded blob bytes; `used` is
+ *                          advanced past the consumed region.
+ *
+ * @retval true   Dispatch and execution succeeded.
+ * @retval false  Command not found, arguments invalid, or bad arena.
+ */
+bool ce_dispatch_from_line_ex(const char *line_str, ce_arena_st *arena_pst);
+
+/**
+ * @enum ce_status_et
+ * @brief Precise dispatch outcome codes.
+ */
+typedef enum {
+    CE_STATUS_OK_e = 0,          /**< Command executed successfully */
+    CE_STATUS_BAD_INPUT_e,       /**< NULL, oversized, or empty input line */
+    CE_STATUS_UNKNOWN_COMMAND_e, /**< No signature matches the command hash */
+    CE_STATUS_ARG_COUNT_e,       /**< Argument count does not match the signature */
+    CE_STATUS_PARSE_FAIL_e,      /**< An argument token failed to parse */
+    CE_STATUS_HANDLER_FAIL_e     /**< The handler ran and reported failure */
+} ce_status_et;
+
+/**
+ * @struct ce_error_info_st
+ * @brief Failure details populated by `ce_dispatch_from_line_status()`.
+ *
+ * All fields are plain integers so a console can render its own message;
+ * which fields are meaningful depends on the returned status.
+ */
+typedef struct {
+    uint32_t hash_u32;     /**< Command hash (valid once the line tokenized) */
+    uint8_t token_idx_u8;  /**< Failing token index for `CE_STATUS_PARSE_FAIL_e` */
+    uint8_t expected_u8;   /**< Expected argument count for `CE_STATUS_ARG_COUNT_e` */
+    uint8_t got_u8;        /**< Received argument count for `CE_STATUS_ARG_COUNT_e` */
+} ce_error_info_st;
+
+/**
+ * @brief Dispatch a command line, reporting precise failure causes.
+ *
+ * Same pipeline as `ce_dispatch_from_line()` but the outcome is a status
+ * enum and `info_pst` is filled with integer stores only — no printf
+ * formatting anywhere on the error path. Intended for consoles that
+ * render their own diagnostics without enabling formatted logging.
+ *
+ * @param[in]  line_str Null-terminated command string (not modified).
+ * @param[out] info_pst Optional failure details (may be NULL).
+ *
+ * @return `CE_STATUS_OK_e` on success, otherwise the first failure cause.
+ */
+ce_status_et ce_dispatch_from_line_status(const char *line_str, ce_error_info_st *info_pst);
+
+/**
+ * @brief Dispatch a command line by tokenizing the caller's buffer in-place.
+ *
+ * Zero-copy variant of `ce_dispatch_from_line()`: no internal copy and no
+ * length re-scan are performed, making it suitable for hot paths where the
+ * input already lives in a writable buffer (e.g., a UART RX line buffer).
+ *
+ * @warning Destructive: tokenization replaces whitespace in `line` with
+ *          '\0' characters. The buffer contents are invalid afterwards.
+ *
+ * @param[in,out] line  Writable, null-terminated command string.
+ * @param[in]     len   Length of `line` in bytes, excluding the terminator
+ *                      (i.e., `line[len]` must be '\0').
+ *
+ * @retval true   Dispatch and execution succeeded.
+ * @retval false  Command not found, arguments invalid, or bad buffer.
+ */
+bool ce_dispatch_from_line_inplace(char *line, size_t len);
+
+/**
+ * @struct ce_batch_result_st
+ * @brief Aggregate results of a batch dispatch over a multi-line buffer.
+ */
+typedef struct {
+    uint32_t dispatched_u32;     /**< Number of lines dispatched successfully */
+    uint32_t failed_u32;         /**< Number of lines that failed */
+    size_t   first_error_offset; /**< Byte offset of the first failing line,
+                                      or SIZE_MAX if no line failed */
+} ce_batch_result_st;
+
+/**
+ * @brief Dispatch every line of a newline-separated command buffer.
+ *
+ * Walks the buffer in a single pass, splitting on '\n' and dispatching each
+ * line in-place — no per-line copies are made. Lines containing only
+ * whitespace are skipped and counted neither as dispatched nor as failed.
+ * Intended for replaying recorded command scripts where per-call entry
+ * overhead would otherwise dominate.
+ *
+ * @warning Destructive: newline and whitespace characters in `buf` are
+ *          replaced with '\0' during processing.
+ *
+ * @param[in,out] buf      Writable command buffer (`buf[len]` must be '\0').
+ * @param[in]     len      Length of the buffer contents in bytes.
+ * @param[out]    out_pst  Optional aggregate counters (may be NULL).
+ *
+ * @retval true   Every non-empty line dispatched successfully.
+ * @retval false  At least one line failed, or `buf` was invalid.
+ */
+bool ce_dispatch_from_buffer(char *buf, size_t len, ce_batch_result_st *out_pst);
+
+/**
+ * @struct ce_parsed_cmd_st
+ * @brief Self-contained pre-parsed command, reusable across invocations.
+ *
+ * Produced by `ce_parse_line()`. String and blob arguments point into the
+ * embedded `line_ca`/`blobs_ua` buffers, so the struct owns everything it
+ * references and stays valid until overwritten.
+ *
+ * @warning Must not be copied or moved: internal argument values hold
+ *          pointers into the struct's own buffers.
+ */
+typedef struct {
+    const ce_signature_st *sig_pst;       /**< Resolved command signature */
+    ce_arg_value_ut args_a[MAX_TOKENS];   /**< Parsed argument values */
+    ce_token_st tokens_ast[MAX_TOKENS];   /**< Token view into `line_ca` (fused replay) */
+    char line_ca[MAX_LINE_BUF_SIZE];      /**< Embedded tokenized line copy */
+    uint8_t blobs_ua[MAX_ARG_CONTENT_SIZE]; /**< Embedded binary argument storage */
+    uint8_t arg_count_u8;                 /**< Parsed argument count (vectored commands) */
+    uint8_t tokens_count_u8;              /**< Token count, including the command name */
+} ce_parsed_cmd_st;
+
+/**
+ * @brief Parse a command line once into a reusable command object.
+ *
+ * Performs the full tokenize/lookup/validate/parse pipeline and stores the
+ * result in `out_pst`. Pair with `ce_invoke_parsed()` to amortize parsing
+ * cost for commands that are dispatched repeatedly.
+ *
+ * @param[in]  line_str Null-terminated command string (not modified).
+ * @param[out] out_pst  Parsed command object to populate.
+ *
+ * @retval true   Command resolved and all arguments parsed.
+ * @retval false  Unknown command, invalid arguments, or bad input.
+ */
+bool ce_parse_line(const char *line_str, ce_parsed_cmd_st *out_pst);
+
+/**
+ * @brief Invoke a command previously parsed with `ce_parse_line()`.
+ *
+ * Only the handler invocation is performed — no tokenizing, hashing, or
+ * argument parsing. May be called any number of times per parsed object.
+ * Commands from registered module tables replay their fused exec entry
+ * over the stored token view (that entry re-parses its arguments);
+ * primary commands invoke the handler with the pre-parsed values.
+ *
+ * @param[in] cmd_pst Parsed command object.
+ *
+ * @retval true   Handler executed successfully.
+ * @retval false  Handler failed or object invalid.
+ */
+bool ce_invoke_parsed(const ce_parsed_cmd_st *cmd_pst);
+
 #ifdef __cplusplus
 }
 #endif
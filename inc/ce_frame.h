@@ -0,0 +1,57 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_frame.h
+ * @brief Binary wire-protocol dispatch entry point.
+ *
+ * Machine producers (test rigs, host tools) can skip text formatting and
+ * parsing entirely by sending packed binary frames:
+ *
+ *     [u32 command hash, little-endian]
+ *     [argument values, in signature order]
+ *
+ * Argument encoding per `ce_arg_type_et`:
+ *   - integer types:  raw little-endian, natural width (1/2/4/8 bytes)
+ *   - bool:           1 byte (0 = false, nonzero = true)
+ *   - string:         u8 length prefix + raw bytes (no terminator on wire)
+ *   - uint8_ptr blob: u8 length prefix + raw bytes
+ *
+ * The frame length is validated against the command's signature; blobs are
+ * passed to the handler zero-copy (pointing into the frame), strings are
+ * copied once to gain a null terminator. Tokenization and all of
+ * parser_utils.c are bypassed.
+ *
+ * The per-command layout constants for host-side encoders are emitted by
+ * the generator into `ce_frame_layout.h`.
+ */
+
+#ifndef CE_FRAME_H
+#define CE_FRAME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Dispatch a packed binary command frame.
+ *
+ * Resolves the command by hash, decodes the arguments according to the
+ * signature's type list, validates the frame length exactly, and invokes
+ * the handler.
+ *
+ * @param[in] frame Frame bytes (hash + packed arguments).
+ * @param[in] len   Total frame length in bytes.
+ *
+ * @retval true   Frame valid and handler executed successfully.
+ * @retval false  Unknown command, malformed frame, or handler failure.
+ */
+bool ce_dispatch_from_frame(const uint8_t *frame, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CE_FRAME_H */
@@ -27,13 +27,20 @@ extern "C" {
  *
  * No argument type checking is performed. Callers must validate before dispatch.
  *
- * @param sig_pst Pointer to the signature of the handler to invoke.
- * @param args_a  Array of argument values (must match signature exactly).
+ * For vectored commands (`repeat_max_u8` nonzero), `arg_count_u8` tells
+ * the generated shim how many of the trailing values are present; the
+ * handler receives them gathered into a typed array as pointer+count.
+ * Fixed-arity commands ignore the parameter.
+ *
+ * @param sig_pst      Pointer to the signature of the handler to invoke.
+ * @param args_a       Array of argument values (must match signature exactly).
+ * @param arg_count_u8 Number of valid entries in `args_a`.
  *
  * @return true if the handler executed successfully, false otherwise.
  */
 bool ce_invoke_handler(const ce_signature_st *sig_pst,
-                       const ce_arg_value_ut args_a[]);
+                       const ce_arg_value_ut args_a[],
+                       uint8_t arg_count_u8);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,103 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_out.h
+ * @brief Engine-owned bounded output ring for command handler output.
+ *
+ * Handlers that produce output should enqueue bytes with `ce_out_write()`
+ * instead of calling `printf` or writing to the transport directly:
+ * enqueuing is a couple of index updates and a memcpy, so a slow console
+ * can no longer stall the dispatch loop. A low-priority task drains the
+ * ring to the actual transport with `ce_out_drain()`.
+ *
+ * The ring is single-producer single-consumer: all handler output comes
+ * from the one dispatch thread, and one drain task consumes it. Capacity
+ * defaults to 1024 bytes and can be overridden at build time with
+ * `-DCE_OUT_RING_SIZE=<power-of-two>`.
+ */
+
+#ifndef CE_OUT_H
+#define CE_OUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef CE_OUT_RING_SIZE
+#define CE_OUT_RING_SIZE (1024u)  /**< Ring capacity in bytes; must be a power of two */
+#endif
+
+#if (CE_OUT_RING_SIZE & (CE_OUT_RING_SIZE - 1u)) != 0u
+#error "CE_OUT_RING_SIZE must be a power of two"
+#endif
+
+/**
+ * @struct ce_out_state_st
+ * @brief Output ring storage and indices, one instance per engine context.
+ *
+ * Embedded in `ce_ctx_st` (see ce_ctx.h); all output entry points operate
+ * on the active context's instance. Zero-initialized state is an empty
+ * ring.
+ */
+typedef struct {
+    uint8_t ring_ua[CE_OUT_RING_SIZE];  /**< Byte storage */
+    uint32_t write_u32;                 /**< Next byte the producer writes */
+    uint32_t read_u32;                  /**< Next byte the consumer reads */
+} ce_out_state_st;
+
+/**
+ * @typedef ce_out_sink_fn_t
+ * @brief Transport callback invoked by `ce_out_drain()`.
+ *
+ * Receives a contiguous run of pending bytes. Returns the number of bytes
+ * actually consumed; returning less stops the drain early (e.g., when a
+ * UART TX FIFO fills up).
+ */
+typedef size_t (*ce_out_sink_fn_t)(const uint8_t *data, size_t len);
+
+/**
+ * @brief Enqueue handler output bytes.
+ *
+ * Never blocks. If the ring lacks space, only the fitting prefix is
+ * stored.
+ *
+ * @param[in] data Bytes to enqueue.
+ * @param[in] len  Number of bytes.
+ *
+ * @return Number of bytes accepted (may be less than `len` when full).
+ */
+size_t ce_out_write(const uint8_t *data, size_t len);
+
+/**
+ * @brief Enqueue a null-terminated string (terminator excluded).
+ *
+ * @param[in] str_cp String to enqueue.
+ * @return Number of bytes accepted.
+ */
+size_t ce_out_write_str(const char *str_cp);
+
+/**
+ * @brief Drain pending output to a transport sink.
+ *
+ * Must be called from exactly one consumer task. The sink may be invoked
+ * up to twice per call (once per contiguous ring segment).
+ *
+ * @param[in] sink Transport callback.
+ * @return Total number of bytes drained.
+ */
+size_t ce_out_drain(ce_out_sink_fn_t sink);
+
+/**
+ * @brief Number of bytes currently pending in the ring.
+ *
+ * @return Pending byte count.
+ */
+size_t ce_out_pending(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CE_OUT_H */
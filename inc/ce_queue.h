@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_queue.h
+ * @brief Bounded lock-free MPSC command queue with deferred dispatch.
+ *
+ * Optional engine mode for hosts where multiple producer threads (console,
+ * network bridges, shells) feed text commands into a single dispatcher.
+ * Producers copy lines into fixed-size slots with `ce_queue_submit()`; one
+ * consumer runs the regular parse/dispatch pipeline over every pending slot
+ * via `ce_queue_drain()`.
+ *
+ * The ring is a multi-producer single-consumer design with per-slot
+ * sequence numbers, so producers never take a lock and never block each
+ * other. Slots are statically allocated at `MAX_LINE_BUF_SIZE` bytes each,
+ * preserving the engine's zero-dynamic-memory guarantee.
+ *
+ * The queue depth defaults to 16 slots and can be overridden at build time
+ * with `-DCE_QUEUE_DEPTH=<power-of-two>`.
+ */
+
+#ifndef CE_QUEUE_H
+#define CE_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Submit a command line for deferred dispatch.
+ *
+ * Copies the line into a free queue slot. Safe to call concurrently from
+ * multiple threads; lock-free (a single CAS claims a slot).
+ *
+ * @param[in] line_str Null-terminated command string (copied, not retained).
+ *
+ * @retval true   Line enqueued.
+ * @retval false  Queue full, line too long, or null input.
+ */
+bool ce_queue_submit(const char *line_str);
+
+/**
+ * @brief Dispatch every pending queued command.
+ *
+ * Must be called from exactly one consumer thread. Runs each pending slot
+ * through the in-place dispatch pipeline.
+ *
+ * @return Number of commands dispatched (successfully or not).
+ */
+size_t ce_queue_drain(void);
+
+/**
+ * @brief Number of commands currently pending in the queue.
+ *
+ * Approximate under concurrent submission; exact when producers are idle.
+ *
+ * @return Pending command count.
+ */
+size_t ce_queue_pending(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CE_QUEUE_H */
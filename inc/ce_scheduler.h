@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_scheduler.h
+ * @brief Cooperative scheduler for long-running command handlers.
+ *
+ * Commands marked `long_running: true` in YAML return
+ * `CE_LONG_CONTINUE_e` from their first slice; the generated invocation
+ * shim then defers the command's resume function here. The main loop
+ * calls `ce_scheduler_tick()` to advance all pending work in bounded
+ * slices, so command intake never freezes behind a flash erase or
+ * self-test. Short commands keep their zero-overhead direct call.
+ */
+
+#ifndef CE_SCHEDULER_H
+#define CE_SCHEDULER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ce_types.h"
+
+/**
+ * @typedef ce_resume_fn_t
+ * @brief Resume entry for one deferred long-running command.
+ *
+ * Invoked once per `ce_scheduler_tick()` until it stops returning
+ * `CE_LONG_CONTINUE_e`. The handler owns its saved state (typically a
+ * static struct captured during the first slice).
+ */
+typedef ce_long_status_et (*ce_resume_fn_t)(void);
+
+/**
+ * @brief Defers a resume function for execution on subsequent ticks.
+ *
+ * Called by the generated invocation shim when a long-running handler
+ * returns `CE_LONG_CONTINUE_e`; applications may also call it directly.
+ *
+ * @param resume_fn Resume entry to schedule.
+ * @return true on success, false on NULL input or a full scheduler.
+ */
+bool ce_scheduler_defer(ce_resume_fn_t resume_fn);
+
+/**
+ * @brief Runs one slice of every pending long-running command.
+ *
+ * Call from the main loop between dispatches. Each pending resume
+ * function is invoked exactly once; entries returning `CE_LONG_DONE_e`
+ * or `CE_LONG_FAIL_e` are retired.
+ *
+ * @return Number of commands still pending after the tick.
+ */
+size_t ce_scheduler_tick(void);
+
+/**
+ * @brief Number of deferred commands awaiting further ticks.
+ *
+ * @return Pending resume entry count.
+ */
+size_t ce_scheduler_pending(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CE_SCHEDULER_H */
@@ -0,0 +1,111 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_shm.h
+ * @brief POSIX shared-memory command channel for cross-process injection.
+ *
+ * Optional engine mode for POSIX hosts where external processes inject
+ * commands into the dispatching daemon. The channel is a memory-mapped
+ * ring of fixed `MAX_LINE_BUF_SIZE` slots: producers in other processes
+ * map the same object and publish lines with `ce_shm_submit()`, and the
+ * daemon drains them straight into the dispatch pipeline with
+ * `ce_shm_drain()` — no syscalls in steady state.
+ *
+ * The ring reuses the sequence-number MPSC design of the in-process
+ * command queue (see ce_queue.h), so it composes with queue mode: the
+ * single consumer thread calls both `ce_queue_drain()` and
+ * `ce_shm_drain()` from its loop while local threads and external
+ * processes submit concurrently.
+ *
+ * The feature is compiled in with `-DCE_SHM_ENABLE` and requires POSIX
+ * shared memory (`shm_open`/`mmap`; link librt on older glibc). The
+ * mapping is established once at channel creation, preserving the
+ * no-allocation-on-the-dispatch-path guarantee.
+ */
+
+#ifndef CE_SHM_H
+#define CE_SHM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Create the shared-memory channel and map it (consumer side).
+ *
+ * Creates (or re-creates) the POSIX shared-memory object, sizes it for
+ * `slots` command slots, maps it, and initializes the ring header.
+ * Call once from the dispatching daemon before any producer attaches.
+ *
+ * @param[in] name_str POSIX shm name (must start with '/', e.g. "/cevo-cmd").
+ * @param[in] slots    Slot count; must be a power of two.
+ *
+ * @retval true   Channel created and mapped.
+ * @retval false  Invalid arguments, channel already mapped, or a
+ *                shm_open/ftruncate/mmap failure.
+ */
+bool ce_shm_channel_create(const char *name_str, size_t slots);
+
+/**
+ * @brief Attach to an existing channel (producer side).
+ *
+ * Maps a channel previously created by `ce_shm_channel_create()` in the
+ * consumer process and validates its header.
+ *
+ * @param[in] name_str POSIX shm name the consumer created.
+ *
+ * @retval true   Channel mapped and validated.
+ * @retval false  Name invalid, object missing, or layout mismatch
+ *                (different MAX_LINE_BUF_SIZE or magic).
+ */
+bool ce_shm_channel_open(const char *name_str);
+
+/**
+ * @brief Submit a command line into the shared ring.
+ *
+ * Copies the line into a free slot. Safe to call concurrently from any
+ * number of attached processes and threads; lock-free (one CAS claims a
+ * slot). No syscalls are made.
+ *
+ * @param[in] line_str Null-terminated command string (copied, not retained).
+ *
+ * @retval true   Line published.
+ * @retval false  Ring full, line too long, null input, or no channel mapped.
+ */
+bool ce_shm_submit(const char *line_str);
+
+/**
+ * @brief Dispatch every pending command in the shared ring.
+ *
+ * Must be called from exactly one consumer (the creating daemon). Runs
+ * each pending slot through the in-place dispatch pipeline.
+ *
+ * @return Number of commands dispatched (successfully or not).
+ */
+size_t ce_shm_drain(void);
+
+/**
+ * @brief Number of commands currently pending in the shared ring.
+ *
+ * Approximate under concurrent submission; exact when producers are idle.
+ *
+ * @return Pending command count, or 0 if no channel is mapped.
+ */
+size_t ce_shm_pending(void);
+
+/**
+ * @brief Unmap the channel; the creator also unlinks the shm object.
+ *
+ * Producers that merely opened the channel leave the object in place
+ * for other processes.
+ */
+void ce_shm_channel_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CE_SHM_H */
@@ -0,0 +1,115 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_stats.h
+ * @brief Optional per-command dispatch statistics instrumentation.
+ *
+ * Compiled in only when `CE_STATS_ENABLE` is defined; otherwise every hook
+ * collapses to nothing, like the release path of `LOG_DBG` in logger.h.
+ *
+ * When enabled, the engine maintains one counter block per signature-table
+ * entry (indexed like the table itself): dispatch count, parse failures,
+ * and cumulative handler cycles measured through a pluggable timestamp
+ * hook. Per-dispatch overhead is a couple of increments plus two hook
+ * calls.
+ */
+
+#ifndef CE_STATS_H
+#define CE_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "ce_types.h"
+
+/**
+ * @struct ce_stats_entry_st
+ * @brief Counters for one signature-table entry.
+ */
+typedef struct {
+    uint32_t dispatch_count_u32;   /**< Successful handler invocations */
+    uint32_t parse_fail_count_u32; /**< Argument parse failures */
+    uint64_t handler_cycles_u64;   /**< Cumulative handler time (hook units) */
+} ce_stats_entry_st;
+
+/**
+ * @typedef ce_stats_timestamp_fn_t
+ * @brief Timestamp source for handler cycle accounting.
+ *
+ * Typically wired to a cycle counter (DWT->CYCCNT, rdtsc, ...). Must be
+ * cheap: it is called twice per dispatch when stats are enabled.
+ */
+typedef uint32_t (*ce_stats_timestamp_fn_t)(void);
+
+#ifdef CE_STATS_ENABLE
+
+#include "ce_command_ids.h"
+
+/**
+ * @struct ce_stats_state_st
+ * @brief Counter blocks and timestamp hook, one instance per engine context.
+ *
+ * Embedded in `ce_ctx_st` (see ce_ctx.h); all stats entry points operate
+ * on the active context's instance, so per-core contexts accumulate
+ * independent counters.
+ */
+typedef struct {
+    ce_stats_entry_st entries_ast[CE_CMD_COUNT]; /**< One block per table entry */
+    ce_stats_timestamp_fn_t timestamp_fn;        /**< Cycle source, NULL for 0 */
+} ce_stats_state_st;
+
+/**
+ * @brief Install the timestamp hook used for handler cycle accounting.
+ *
+ * Without a hook, cycle accounting stays at zero; counts still work.
+ *
+ * @param fn Timestamp callback, or NULL to disable cycle accounting.
+ */
+void ce_stats_set_timestamp_hook(ce_stats_timestamp_fn_t fn);
+
+/**
+ * @brief Copy the current counters into a caller-provided array.
+ *
+ * Entry `i` corresponds to `ce_table_get_signatures()[i]`.
+ *
+ * @param[out] out_a       Destination array.
+ * @param[in]  max_entries Capacity of `out_a`.
+ *
+ * @return Number of entries copied.
+ */
+size_t ce_stats_snapshot(ce_stats_entry_st *out_a, size_t max_entries);
+
+/**
+ * @brief Reset all counters to zero.
+ */
+void ce_stats_reset(void);
+
+/* Internal hooks called by the dispatcher; not part of the public API */
+void ce_stats_on_dispatch(const ce_signature_st *sig_pst);
+void ce_stats_on_parse_fail(const ce_signature_st *sig_pst);
+void ce_stats_add_cycles(const ce_signature_st *sig_pst, uint32_t delta_u32);
+uint32_t ce_stats_timestamp(void);
+
+#define CE_STATS_DISPATCH(sig_pst)       ce_stats_on_dispatch(sig_pst)
+#define CE_STATS_PARSE_FAIL(sig_pst)     ce_stats_on_parse_fail(sig_pst)
+#define CE_STATS_TIMESTAMP()             ce_stats_timestamp()
+#define CE_STATS_ADD_CYCLES(sig_pst, d)  ce_stats_add_cycles((sig_pst), (d))
+
+#else
+
+/* Disabled: hooks compile to nothing */
+#define CE_STATS_DISPATCH(sig_pst)       ((void)0)
+#define CE_STATS_PARSE_FAIL(sig_pst)     ((void)0)
+#define CE_STATS_TIMESTAMP()             (0u)
+#define CE_STATS_ADD_CYCLES(sig_pst, d)  ((void)(d))
+
+#endif /* CE_STATS_ENABLE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CE_STATS_H */
@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_stream.h
+ * @brief Incremental streaming front-end for byte-at-a-time command input.
+ *
+ * Feeds the dispatcher directly from chunked byte sources (DMA buffers,
+ * UART FIFOs) without waiting for a complete line: tokenization happens
+ * as bytes arrive, so when the line terminator lands only the hash
+ * lookup and handler invocation remain. End-of-line dispatch latency is
+ * independent of line length.
+ */
+
+#ifndef CE_STREAM_H
+#define CE_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Feeds a chunk of received bytes into the streaming tokenizer.
+ *
+ * Bytes are tokenized incrementally into an internal line buffer;
+ * every '\n' or '\r' triggers immediate dispatch of the assembled
+ * command. Partial lines carry over to the next call, so chunks may
+ * split lines (and even tokens) at any byte boundary.
+ *
+ * Oversized lines and token-count overflows are dropped with an error
+ * log; discarding lasts until the next terminator, after which the
+ * stream resynchronizes automatically.
+ *
+ * @param chunk_u8p Received bytes (need not be null-terminated).
+ * @param len       Number of bytes in the chunk.
+ * @return Number of commands dispatched successfully from this chunk.
+ */
+size_t ce_feed(const uint8_t *chunk_u8p, size_t len);
+
+/**
+ * @brief Discards any partially assembled line.
+ *
+ * Call on transport resets (UART break, reconnect) so stale bytes from
+ * the interrupted line cannot prefix the next command.
+ */
+void ce_feed_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CE_STREAM_H */
@@ -34,6 +34,68 @@ const ce_signature_st* ce_table_get_signatures(void);
  */
 size_t ce_table_get_signatures_count(void);
 
+/**
+ * @brief Resolve a command signature by its 32-bit name hash.
+ *
+ * The generated table is sorted by ascending hash, so resolution is a
+ * binary search (O(log n)) instead of a scan over all registered commands.
+ *
+ * @param hash_u32 DJB2 hash of the command name.
+ * @return Pointer to the matching `ce_signature_st`, or NULL if not found.
+ */
+const ce_signature_st* ce_table_lookup_hash(uint32_t hash_u32);
+
+/**
+ * @brief Register an additional module signature table.
+ *
+ * Firmware modules carrying their own generated command sets register
+ * their tables here instead of merging all YAMLs into one monolith. The
+ * registry has a fixed capacity (`CE_TABLE_REGISTRY_SIZE`, default 4)
+ * and each table must be sorted by strictly ascending hash — the same
+ * invariant the generator guarantees for `ce_table.c`.
+ *
+ * @param table_ast Hash-sorted array of signatures (must stay valid).
+ * @param count     Number of entries in the array.
+ * @return true on success, false on NULL/empty table, unsorted entries,
+ *         or a full registry.
+ */
+bool ce_table_register(const ce_signature_st *table_ast, size_t count);
+
+/**
+ * @brief Resolve a hash across the generated table and all registered tables.
+ *
+ * Two-level lookup: the primary generated table is searched first and
+ * wins on duplicate hashes; registered tables are then binary-searched
+ * in registration order.
+ *
+ * @param hash_u32 DJB2 hash of the command name.
+ * @return Pointer to the matching `ce_signature_st`, or NULL if not found.
+ */
+const ce_signature_st* ce_table_resolve_hash(uint32_t hash_u32);
+
+/**
+ * @brief Get the command names sorted lexicographically.
+ *
+ * Intended for interactive consoles (tab-completion, `help <prefix>`).
+ * The order differs from the hash-sorted signature table: index results
+ * from `ce_table_find_prefix()` apply to this array only.
+ *
+ * @return Pointer to constant array of `ce_table_get_signatures_count()` names.
+ */
+const char *const *ce_table_get_names(void);
+
+/**
+ * @brief Find all command names starting with a prefix.
+ *
+ * Two binary searches over the sorted name index resolve the matching
+ * range in O(log n); an empty prefix matches every command.
+ *
+ * @param prefix_cp   Null-terminated prefix to match.
+ * @param first_idx_p Receives the index of the first match in `ce_table_get_names()`.
+ * @return Number of matching names (0 on no match or NULL input).
+ */
+size_t ce_table_find_prefix(const char *prefix_cp, size_t *first_idx_p);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,9 +22,26 @@ extern "C" {
 #include <stdio.h>
 #include <inttypes.h>
 
+/* Project-specific limits from the generated ce_config.h (YAML 'limits:'
+ * section) take precedence; the values below are fallback defaults.
+ */
+#if defined(__has_include)
+#if __has_include("ce_config.h")
+#include "ce_config.h"
+#endif
+#endif
+
+#ifndef MAX_TOKENS
 #define MAX_TOKENS            (8U)    /**< Maximum number of tokens (command + args) */
+#endif
+
+#ifndef MAX_ARG_CONTENT_SIZE
 #define MAX_ARG_CONTENT_SIZE  (64U)   /**< Max size in bytes for a single string or binary argument */
+#endif
+
+#ifndef MAX_LINE_BUF_SIZE
 #define MAX_LINE_BUF_SIZE     (256U)  /**< Max length of the input command line */
+#endif
 
 /**
  * @enum ce_arg_type_et
@@ -70,21 +87,72 @@ typedef union {
     const uint8_t  *bytes_u8p;     /**< Pointer to raw byte array */
 } ce_arg_value_ut;
 
+/**
+ * @struct ce_token_st
+ * @brief One tokenized slice of a command line: pointer plus length.
+ *
+ * Produced by the in-place tokenizer, which already walks every byte of
+ * the line and knows where each token ends. Carrying the length forward
+ * lets the hash and the hex decoder skip their own re-scans. Tokens
+ * remain null-terminated in the underlying buffer, so `ptr_cp` still
+ * works wherever a plain C string is needed.
+ */
+typedef struct {
+    const char *ptr_cp;  /**< Token start (null-terminated in the line buffer) */
+    uint16_t len_u16;    /**< Token length, excluding the terminator */
+} ce_token_st;
+
 /**
  * @typedef handler_func_t
  * @brief Generic function pointer (casted at dispatch time).
  */
 typedef void (*handler_func_t)(void);
 
+/**
+ * @enum ce_long_status_et
+ * @brief Progress states returned by long-running command handlers.
+ *
+ * Handlers of commands marked `long_running: true` in YAML return this
+ * instead of bool: `CE_LONG_CONTINUE_e` asks the scheduler to resume the
+ * work in a later `ce_scheduler_tick()` slice.
+ */
+typedef enum {
+    CE_LONG_DONE_e = 0,   /**< Work finished successfully */
+    CE_LONG_CONTINUE_e,   /**< More slices needed; resume on the next tick */
+    CE_LONG_FAIL_e        /**< Work failed; do not resume */
+} ce_long_status_et;
+
+/**
+ * @typedef ce_exec_fn_t
+ * @brief Generated fused parse-and-invoke entry point for one command.
+ *
+ * Receives the full token array (command name at index 0, arguments
+ * following) and runs the exact parse sequence fixed by the command's
+ * signature before calling the handler directly — no type switch, no
+ * `ce_arg_value_ut` marshalling. Argument count must be validated by the
+ * caller beforehand.
+ */
+typedef bool (*ce_exec_fn_t)(char *tokens_apc[]);
+
 /**
  * @struct ce_signature_st
  * @brief Command signature metadata used for dispatching.
+ *
+ * A command whose trailing argument is marked `repeat: true` in YAML is
+ * "vectored": `repeat_max_u8` is nonzero and the last entry of `types_e`
+ * may occur between `repeat_min_u8` and `repeat_max_u8` times on the
+ * line. The handler then receives the repeated values as pointer+count
+ * instead of a single scalar. Fixed-arity commands carry 0 in both
+ * fields.
  */
 typedef struct {
     uint32_t hash_u32;                 /**< Hashed command name */
     handler_func_t handler;            /**< Function pointer to the command implementation */
+    ce_exec_fn_t exec_fn;              /**< Fused parse-and-invoke entry (NULL: generic path) */
     const ce_arg_type_et *types_e;     /**< Array of argument types */
-    uint8_t type_count_u8;             /**< Number of arguments expected */
+    uint8_t type_count_u8;             /**< Number of declared arguments */
+    uint8_t repeat_min_u8;             /**< Min occurrences of the trailing argument (0: fixed arity) */
+    uint8_t repeat_max_u8;             /**< Max occurrences of the trailing argument (0: fixed arity) */
 } ce_signature_st;
 
 #ifdef UNIT_TEST
@@ -3,7 +3,10 @@
  * @file logger.h
  * @brief Minimal logging macro with automatic file, line, and function context.
  *
- * Designed for critical systems: collapsible in production builds.
+ * Designed for critical systems: the hot path only appends fixed binary
+ * records to a lock-free ring; formatting and I/O are deferred to
+ * `log_drain()`. Unit-test builds additionally print synchronously for
+ * readable test output.
  */
 
 #ifndef CE_LOGGER_H
@@ -14,6 +17,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
 
 /**
  * @enum ce_file_id_et
@@ -22,22 +26,121 @@ extern "C" {
 typedef enum {
     CE_FILE_DISPATCH_e = 0,
     CE_FILE_PARSER_UTILS_e,
+    CE_FILE_QUEUE_e,
+    CE_FILE_FRAME_e,
+    CE_FILE_OUT_e,
+    CE_FILE_TABLE_e,
+    CE_FILE_SCHEDULER_e,
+    CE_FILE_SHM_e,
+    CE_FILE_CTX_e,
     /* Add other files here */
     CE_FILE_MAX_e
 } ce_file_id_et;
 
+#ifndef CE_LOG_RING_DEPTH
+#define CE_LOG_RING_DEPTH (32u)  /**< Record count; must be a power of two */
+#endif
+
+#if (CE_LOG_RING_DEPTH & (CE_LOG_RING_DEPTH - 1u)) != 0u
+#error "CE_LOG_RING_DEPTH must be a power of two"
+#endif
+
 /**
- * @brief Stores a log entry with file ID and line number in a circular buffer.
+ * @struct log_record_st
+ * @brief One fixed-size binary log record stored in the log ring.
  *
- * This allows later inspection of recent error locations even if printing
- * is disabled (e.g., in release builds).
+ * Records carry raw integers only; all text formatting happens in the
+ * consumer's formatter callback, off the dispatch path.
+ */
+typedef struct {
+    uint32_t timestamp_u32; /**< Capture time (from the timestamp hook, 0 if unset) */
+    uint32_t args_ua[2];    /**< Up to two raw argument words */
+    uint16_t line_u16;      /**< Line number in the source file */
+    uint8_t file_id_u8;     /**< Identifier of the source file (ce_file_id_et) */
+    uint8_t arg_count_u8;   /**< Number of valid entries in args_ua */
+} log_record_st;
+
+/**
+ * @typedef log_formatter_fn_t
+ * @brief Consumer callback formatting one drained log record.
+ */
+typedef void (*log_formatter_fn_t)(const log_record_st *record_pst);
+
+/**
+ * @typedef log_timestamp_fn_t
+ * @brief Application hook supplying record timestamps (e.g., DWT cycle counter).
+ */
+typedef uint32_t (*log_timestamp_fn_t)(void);
+
+/**
+ * @struct ce_log_state_st
+ * @brief Log ring storage and indices, one instance per engine context.
+ *
+ * Embedded in `ce_ctx_st` (see ce_ctx.h); all logger entry points operate
+ * on the active context's instance. Zero-initialized state is an empty
+ * ring.
+ */
+typedef struct {
+    log_record_st ring_ast[CE_LOG_RING_DEPTH]; /**< Record storage */
+    uint32_t write_u32;                 /**< Next record the producer writes */
+    uint32_t read_u32;                  /**< Next record the consumer reads */
+    uint32_t dropped_u32;               /**< Records lost to a full ring */
+    log_timestamp_fn_t timestamp_hook;  /**< Timestamp source, NULL for 0 */
+} ce_log_state_st;
+
+/**
+ * @brief Stores a log record with file ID and line number in the log ring.
+ *
+ * Producer side of the lock-free SPSC ring: a handful of stores, no
+ * formatting, no I/O. When the ring is full the record is dropped and
+ * counted (see `log_dropped()`), so a log storm cannot stall the
+ * dispatch path.
  *
  * @param file_id Unique file ID identifying the source file.
  * @param line    Line number in the source file where the log call was made.
  */
 void log_event(ce_file_id_et file_id, uint16_t line);
 
-#if defined(UNIT_TEST) || defined(CE_LOG_ENABLE)
+/**
+ * @brief Stores a log record with up to two raw argument words attached.
+ *
+ * Same cost profile as `log_event()`; arguments are stored verbatim and
+ * interpreted by the formatter during `log_drain()`.
+ *
+ * @param file_id Unique file ID identifying the source file.
+ * @param line    Line number in the source file.
+ * @param arg0    First raw argument word.
+ * @param arg1    Second raw argument word.
+ */
+void log_event_args(ce_file_id_et file_id, uint16_t line, uint32_t arg0, uint32_t arg1);
+
+/**
+ * @brief Drains buffered log records to a formatter callback.
+ *
+ * Consumer side of the ring; must be called from exactly one task
+ * (e.g., the idle loop or a low-priority logger task). All string
+ * formatting and I/O belongs in the callback.
+ *
+ * @param formatter Callback invoked once per drained record.
+ * @return Number of records drained.
+ */
+size_t log_drain(log_formatter_fn_t formatter);
+
+/**
+ * @brief Number of records dropped because the ring was full.
+ *
+ * @return Total dropped record count since boot.
+ */
+uint32_t log_dropped(void);
+
+/**
+ * @brief Installs the timestamp source for subsequent records.
+ *
+ * @param hook Timestamp callback, or NULL to record 0 timestamps.
+ */
+void log_set_timestamp_hook(log_timestamp_fn_t hook);
+
+#if defined(UNIT_TEST)
 
 #include <stdio.h>
 
@@ -104,20 +207,24 @@ static inline const char *get_filename(const char *path)
 #else
 
 /**
- * @brief Stores log entry in history buffer; no print in release builds.
+ * @brief Stores a binary record in the log ring; no formatting on the hot path.
+ *
+ * The printf-style format arguments are discarded here — production
+ * builds format records in the `log_drain()` callback instead, so the
+ * error-path cost stays constant regardless of verbosity. Call sites
+ * needing payload words should use `log_event_args()` directly.
  */
 #define LOG_ERR(file_id, fmt, ...)              \
     do {                                        \
         log_event(file_id, (uint16_t)__LINE__); \
-        /* No print in release */               \
     } while (0)
 
 /**
- * @brief Debug logs do not store events in release builds.
+ * @brief Debug logs do not store events outside unit-test builds.
  */
 #define LOG_DBG(file_id, fmt, ...)    (void)0;
 
-#endif /* UNIT_TEST || CE_LOG_ENABLE */
+#endif /* UNIT_TEST */
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,62 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_ctx.c
+ * @brief Implements engine context selection and the built-in default context.
+ *
+ * The default context is plain static storage, so the zero-context
+ * configuration costs nothing beyond one pointer indirection per state
+ * access. The active-context pointer is thread-local where the compiler
+ * supports it (`__thread` on GCC/Clang), which is what lets one context
+ * per core coexist; without that support the pointer is process-wide and
+ * only a single dispatcher thread may run — the same restriction the
+ * ring buffers already carry on such toolchains.
+ */
+
+#include <string.h>
+
+#include "ce_ctx.h"
+#include "ce_dispatch.h"
+
+static ce_ctx_st ctx_default;  /* zero-initialized: ready for use as-is */
+
+#if defined(__GNUC__) || defined(__clang__)
+static __thread ce_ctx_st *ctx_active_pst = &ctx_default;
+#else
+#warning "ce_ctx: no thread-local storage on this compiler, one dispatcher thread only!"
+static ce_ctx_st *ctx_active_pst = &ctx_default;
+#endif
+
+ce_ctx_st *ce_ctx_default(void)
+{
+    return &ctx_default;
+}
+
+ce_ctx_st *ce_ctx_active(void)
+{
+    return ctx_active_pst;
+}
+
+void ce_ctx_activate(ce_ctx_st *ctx_pst)
+{
+    ctx_active_pst = (NULL != ctx_pst) ? ctx_pst : &ctx_default;
+}
+
+void ce_ctx_init(ce_ctx_st *ctx_pst)
+{
+    if (NULL != ctx_pst)
+    {
+        memset(ctx_pst, 0, sizeof(*ctx_pst));
+    }
+}
+
+bool ce_dispatch_ctx(ce_ctx_st *ctx_pst, const char *line_str)
+{
+    ce_ctx_st *prev_pst = ctx_active_pst;
+    bool ok_b;
+
+    ce_ctx_activate(ctx_pst);
+    ok_b = ce_dispatch_from_line(line_str);
+    ctx_active_pst = prev_pst;
+
+    return ok_b;
+}
@@ -11,6 +11,7 @@
 #include <limits.h>
 
 #include "parser_utils.h"
+#include "ce_dispatch_internal.h"
 
 #include "logger.h"
 #include "ce_table.h"
@@ -18,12 +19,17 @@
 #include "ce_invoke_handler.h"
 #include "ce_dispatch.h"
 #include "ce_hash.h"
+#include "ce_stats.h"
+#include "ce_ctx.h"
 
-typedef struct {
-    uint8_t buffer[MAX_ARG_CONTENT_SIZE];
-    size_t used;
-} scratch_buffer_st;
-
+/* Dispatch matches commands on the 32-bit DJB2 hash alone, with no name
+ * comparison. That is only sound when the generator proved the table free
+ * of hash collisions across all merged YAML inputs; refuse to build
+ * against a table header that does not carry that proof.
+ */
+#ifndef CE_TABLE_COLLISION_FREE
+#error "ce_command_ids.h lacks CE_TABLE_COLLISION_FREE: regenerate APIs with the collision-checking generator"
+#endif
 
 #define IS_WHITESPACE(c) ((c) == ' ' || (c) == '\t' || (c) == '\r' || (c) == '\n')
 
@@ -48,6 +54,26 @@ static bool validate_argument_count(size_t tokens_count, const ce_signature_st *
 
     size_t arg_count = (tokens_count > 0u) ? (tokens_count - 1u) : 0u;
 
+    if (sig_pst->repeat_max_u8 > 0u)
+    {
+        /* Vectored command: the trailing argument may occur between
+         * repeat_min and repeat_max times (the declared occurrence in
+         * type_count_u8 counts as one).
+         */
+        size_t min_count = ((size_t)sig_pst->type_count_u8 - 1u) + sig_pst->repeat_min_u8;
+        size_t max_count = ((size_t)sig_pst->type_count_u8 - 1u) + sig_pst->repeat_max_u8;
+
+        if ((arg_count < min_count) || (arg_count > max_count))
+        {
+            LOG_ERR(CE_FILE_DISPATCH_e,
+                    "Argument count mismatch (got %lu, expected %lu..%lu)",
+                    arg_count, min_count, max_count);
+            return false;
+        }
+
+        return true;
+    }
+
     if (arg_count != sig_pst->type_count_u8)
     {
         LOG_ERR(CE_FILE_DISPATCH_e,
@@ -60,16 +86,18 @@ static bool validate_argument_count(size_t tokens_count, const ce_signature_st *
 }
 
 static bool parse_value_by_type(ce_arg_type_et type_e,
-                                const char *token_cp,
+                                const ce_token_st *token_pst,
                                 ce_arg_value_ut *out_val_p,
-                                scratch_buffer_st *scratch)
+                                ce_arena_st *scratch)
 {
-    if ((NULL == token_cp) || (NULL == out_val_p))
+    if ((NULL == token_pst) || (NULL == token_pst->ptr_cp) || (NULL == out_val_p))
     {
         LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
         return false;
     }
 
+    const char *token_cp = token_pst->ptr_cp;
+
     switch (type_e)
     {
         case TYPE_UINT8_e:
@@ -111,13 +139,15 @@ static bool parse_value_by_type(ce_arg_type_et type_e,
             }
 
             size_t bytes_len = 0;
-            if (!parse_hex_string(token_cp, scratch->buffer + scratch->used, MAX_ARG_CONTENT_SIZE, &bytes_len))
+            if (!parse_hex_string_n(token_cp, token_pst->len_u16,
+                                    scratch->base_u8p + scratch->used,
+                                    scratch->size - scratch->used, &bytes_len))
             {
                 LOG_ERR(CE_FILE_DISPATCH_e, "Failed to parse hex string: '%s'", token_cp);
                 return false;
             }
 
-            out_val_p->bytes_u8p = scratch->buffer + scratch->used;
+            out_val_p->bytes_u8p = scratch->base_u8p + scratch->used;
             scratch->used += bytes_len;
 
             return true;
@@ -134,55 +164,70 @@ static bool parse_value_by_type(ce_arg_type_et type_e,
  * This function uses the provided command signature to convert string tokens into
  * strongly typed values stored in `ce_arg_value_ut` entries. Scalars are parsed directly.
  * String arguments point into the pre-tokenized `line_buf`. Binary hex strings are parsed
- * into a shared static buffer and referenced by pointer.
+ * into the supplied arena and referenced by pointer.
  *
  * @param sig_pst        Pointer to the command's signature descriptor.
- * @param tokens_ca      Array of token pointers (command name + arguments).
+ * @param tokens_ast     Array of tokens (command name + arguments), each
+ *                       carrying its length from the tokenizer.
+ * @param arg_count      Number of argument tokens present on the line; for
+ *                       vectored signatures this drives the parse loop,
+ *                       fixed-arity signatures use `type_count_u8`.
  * @param out_args_a     Output array where parsed argument values will be stored.
+ * @param scratch        Arena receiving decoded blob bytes; may be NULL for
+ *                       signatures without `TYPE_UINT8_PTR_e` arguments.
  *
  * @return true if parsing succeeded for all arguments, false otherwise.
  *
  * @note
- * - Assumes `tokens_ca` was null-terminated and split in-place from `line_buf`.
+ * - Assumes tokens were null-terminated and split in-place from `line_buf`.
  * - Caller must dispatch handler before the next `parse_arguments()` call.
  */
 
 static bool parse_arguments(const ce_signature_st *sig_pst,
-                            char *tokens_ca[],
+                            const ce_token_st tokens_ast[],
+                            size_t arg_count,
                             ce_arg_value_ut out_args_a[MAX_TOKENS],
-                            scratch_buffer_st *scratch)
+                            ce_arena_st *scratch)
 {
+    size_t parse_count;
+
     if ((NULL == sig_pst)    ||
-        (NULL == tokens_ca)  ||
-        (NULL == out_args_a) ||
-        (NULL == scratch))
+        (NULL == tokens_ast) ||
+        (NULL == out_args_a))
     {
         LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
         return false;
     }
 
-    if (sig_pst->type_count_u8 > MAX_PARSABLE_ARGUMENTS)
+    parse_count = (sig_pst->repeat_max_u8 > 0u) ? arg_count
+                                                : sig_pst->type_count_u8;
+
+    if (parse_count > MAX_PARSABLE_ARGUMENTS)
     {
-        LOG_ERR(CE_FILE_DISPATCH_e, "Too many arguments: %u", sig_pst->type_count_u8);
+        LOG_ERR(CE_FILE_DISPATCH_e, "Too many arguments: %lu",
+                (unsigned long)parse_count);
         return false;
     }
 
-    for (uint8_t i = 0u; i < sig_pst->type_count_u8; ++i)
+    for (uint8_t i = 0u; i < parse_count; ++i)
     {
-        const char *token_cp = tokens_ca[i + ARG_OFFSET];
-        ce_arg_type_et type_e = sig_pst->types_e[i];
+        const ce_token_st *token_pst = &tokens_ast[i + ARG_OFFSET];
+        /* Tokens past the declared list repeat the trailing type */
+        ce_arg_type_et type_e = (i < sig_pst->type_count_u8)
+                                    ? sig_pst->types_e[i]
+                                    : sig_pst->types_e[sig_pst->type_count_u8 - 1u];
 
-        if (NULL == token_cp)
+        if (NULL == token_pst->ptr_cp)
         {
             LOG_ERR(CE_FILE_DISPATCH_e, "Missing argument %u", (unsigned)(i + 1u));
             return false;
         }
 
-        if (!parse_value_by_type(type_e, token_cp, &out_args_a[i], scratch))
+        if (!parse_value_by_type(type_e, token_pst, &out_args_a[i], scratch))
         {
             LOG_ERR(CE_FILE_DISPATCH_e,
                     "Failed to parse argument %u as type %d (token: '%s')",
-                    (unsigned)(i + 1u), (int)type_e, token_cp);
+                    (unsigned)(i + 1u), (int)type_e, token_pst->ptr_cp);
             return false;
         }
     }
@@ -193,123 +238,402 @@ static bool parse_arguments(const ce_signature_st *sig_pst,
 /**
  * @brief Searches for a command signature by its hash.
  *
+ * Delegates to `ce_table_resolve_hash()`, which binary-searches the
+ * hash-sorted generated table and then any tables added through
+ * `ce_table_register()`, instead of scanning every entry.
+ *
+ * With `CE_LOOKUP_CACHE_SIZE` defined, a small direct-mapped cache is
+ * consulted first: command traffic is heavily skewed towards a handful of
+ * telemetry commands, so the common case becomes one compare and a pointer
+ * load. Misses fall through to the table and fill the cache slot. The
+ * cache lives in the active engine context (see ce_ctx.h), so per-core
+ * contexts never contend on it.
+ *
  * @param hash 32-bit hash of the command name.
  * @return Pointer to the signature if found, NULL otherwise.
  */
 static const ce_signature_st *lookup_signature_by_hash(uint32_t hash)
 {
-    const ce_signature_st *table = ce_table_get_signatures();
-    size_t count = ce_table_get_signatures_count();
+#ifdef CE_LOOKUP_CACHE_SIZE
+    ce_lookup_cache_entry_st *entry_pst =
+        &ce_ctx_active()->lookup_cache_ast[hash & (CE_LOOKUP_CACHE_SIZE - 1u)];
+    const ce_signature_st *sig_pst;
+
+    if ((entry_pst->hash_u32 == hash) && (NULL != entry_pst->sig_pst))
+    {
+        return entry_pst->sig_pst;
+    }
+
+    sig_pst = ce_table_resolve_hash(hash);
+    if (NULL != sig_pst)
+    {
+        entry_pst->hash_u32 = hash;
+        entry_pst->sig_pst = sig_pst;
+    }
+
+    return sig_pst;
+#else
+    return ce_table_resolve_hash(hash);
+#endif
+}
+
+/**
+ * @brief True when a signature lives outside the primary generated table.
+ *
+ * Signatures from registered module tables are unknown to the generated
+ * `ce_invoke_handler()` switch; every invoke site must take their fused
+ * exec entry instead of the generic invoke.
+ *
+ * @param sig_pst Resolved signature pointer.
+ * @return true for registered (foreign) signatures, false for primary ones.
+ */
+static bool is_foreign_signature(const ce_signature_st *sig_pst)
+{
+    const ce_signature_st *table_ast = ce_table_get_signatures();
+
+    return (sig_pst < table_ast) ||
+           ((size_t)(sig_pst - table_ast) >= ce_table_get_signatures_count());
+}
+
+/*--------------------------------------------------------------------------------------------------
+ *  Token-end scanning
+ *
+ *  Finds the first whitespace or '\0' starting at `ptr`. The variant is
+ *  selected at compile time: SSE2 on x86 hosts, a word-at-a-time SWAR scan
+ *  on other 64-bit-capable targets, and the plain byte loop when
+ *  CE_TOKENIZER_PORTABLE is defined (e.g., for size-constrained Thumb
+ *  cross builds).
+ *------------------------------------------------------------------------------------------------*/
+
+#if !defined(CE_TOKENIZER_PORTABLE) && defined(__SSE2__)
+
+#include <emmintrin.h>
+
+static char *scan_token_end(char *ptr)
+{
+    /* Byte loop up to 16-byte alignment so the vector loads below can
+     * never cross a page boundary past the terminating '\0'.
+     */
+    while ((((uintptr_t)ptr & 15u) != 0u) && (*ptr != '\0') && !IS_WHITESPACE(*ptr))
+    {
+        ptr++;
+    }
+
+    if (((uintptr_t)ptr & 15u) != 0u)
+    {
+        return ptr;  /* hit whitespace or '\0' before alignment */
+    }
+
+    for (;;)
+    {
+        __m128i chunk = _mm_load_si128((const __m128i *)(const void *)ptr);
+        __m128i stop = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_setzero_si128()),
+                         _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' '))),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t')),
+                         _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')),
+                                      _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')))));
+        unsigned mask = (unsigned)_mm_movemask_epi8(stop);
+
+        if (mask != 0u)
+        {
+            return ptr + __builtin_ctz(mask);
+        }
+
+        ptr += 16;
+    }
+}
+
+#elif !defined(CE_TOKENIZER_PORTABLE)
+
+/* SWAR bit tricks: detect a zero byte anywhere in a 64-bit word */
+#define SWAR_ONES_U64   (0x0101010101010101ull)
+#define SWAR_HIGHS_U64  (0x8080808080808080ull)
+#define SWAR_HAS_ZERO(w)   (((w) - SWAR_ONES_U64) & ~(w) & SWAR_HIGHS_U64)
+#define SWAR_REPEAT(c)     (SWAR_ONES_U64 * (uint64_t)(uint8_t)(c))
+
+static char *scan_token_end(char *ptr)
+{
+    /* Byte loop up to 8-byte alignment so word loads stay in-bounds */
+    while ((((uintptr_t)ptr & 7u) != 0u) && (*ptr != '\0') && !IS_WHITESPACE(*ptr))
+    {
+        ptr++;
+    }
 
-    for (size_t i = 0; i < count; ++i)
+    if (((uintptr_t)ptr & 7u) != 0u)
     {
-        if (table[i].hash_u32 == hash)
+        return ptr;  /* hit whitespace or '\0' before alignment */
+    }
+
+    for (;;)
+    {
+        uint64_t word;
+        memcpy(&word, ptr, sizeof(word));  /* single aligned load */
+
+        uint64_t stop = SWAR_HAS_ZERO(word)
+                      | SWAR_HAS_ZERO(word ^ SWAR_REPEAT(' '))
+                      | SWAR_HAS_ZERO(word ^ SWAR_REPEAT('\t'))
+                      | SWAR_HAS_ZERO(word ^ SWAR_REPEAT('\r'))
+                      | SWAR_HAS_ZERO(word ^ SWAR_REPEAT('\n'));
+
+        if (stop != 0u)
         {
-            return &table[i];
+            /* Endianness-agnostic: re-scan the 8 bytes for the boundary */
+            while ((*ptr != '\0') && !IS_WHITESPACE(*ptr))
+            {
+                ptr++;
+            }
+            return ptr;
         }
+
+        ptr += 8;
     }
+}
 
-    return NULL;
+#else
+
+static char *scan_token_end(char *ptr)
+{
+    while ((*ptr != '\0') && !IS_WHITESPACE(*ptr))
+    {
+        ptr++;
+    }
+
+    return ptr;
 }
 
+#endif /* tokenizer variant selection */
+
 /**
  * @brief Splits a command line string into tokens in-place.
  *
  * This function modifies the input string by replacing whitespace with '\0' and
- * populates the tokens array with pointers to individual tokens.
+ * populates the token array with pointer/length pairs. Token bodies are
+ * skipped via `scan_token_end()`, which uses SIMD/SWAR scanning where the
+ * target supports it — the end position it returns yields each token's
+ * length for free, so later pipeline stages (hashing, hex decoding) never
+ * re-scan the bytes.
  *
  * @param line Input string to tokenize (modified in-place).
- * @param tokens Output array to store pointers to tokens.
+ * @param tokens_ast Output array to store token pointer/length pairs.
  * @param tokens_count Output parameter to receive number of tokens.
  *
  * @return true if tokenization succeeded without truncation, false otherwise.
  */
-static bool parse_line_to_tokens(char *line, char *tokens[], size_t *tokens_count)
+static bool parse_line_to_tokens(char *line, ce_token_st tokens_ast[], size_t *tokens_count)
 {
     size_t count = 0u;
     char *ptr = line;
-    bool in_token = false;
 
-    if ((NULL == line) || (NULL == tokens) || (NULL == tokens_count))
+    if ((NULL == line) || (NULL == tokens_ast) || (NULL == tokens_count))
     {
         LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
         return false;
     }
 
-    while ((*ptr != '\0') && (count < MAX_TOKENS))
+    for (;;)
     {
-        if (IS_WHITESPACE(*ptr))
+        /* Skip and null-out whitespace between tokens */
+        while ((*ptr != '\0') && IS_WHITESPACE(*ptr))
         {
             *ptr = '\0';  /* split token */
-            in_token = false;
+            ptr++;
         }
-        else if (!in_token)
+
+        if ('\0' == *ptr)
         {
-            tokens[count++] = ptr;
-            in_token = true;
+            break;
         }
-        else
+
+        if (count == MAX_TOKENS)
         {
+            LOG_ERR(CE_FILE_DISPATCH_e,
+                    "Too many tokens, maximum allowed is %u, input truncated at token count %u",
+                    (unsigned)MAX_TOKENS, (unsigned)count);
+            return false;
         }
-        ptr++;
+
+        tokens_ast[count].ptr_cp = ptr;
+        ptr = scan_token_end(ptr);
+        tokens_ast[count].len_u16 = (uint16_t)(ptr - tokens_ast[count].ptr_cp);
+        count++;
     }
 
-    /* If we stopped due to reaching MAX_TOKENS but still inside a token,
-     * consume the rest of this token to avoid partial token error
+    *tokens_count = count;
+    return true;
+}
+
+/**
+ * @brief Runs a command's fused exec entry from a token array.
+ *
+ * `ce_exec_fn_t` keeps the generated code's plain string-array ABI; since
+ * tokens stay null-terminated in the writable line buffer, a pointer view
+ * over the token array is enough — no copying.
+ */
+static bool run_exec_fn(const ce_signature_st *sig_pst,
+                        const ce_token_st tokens_ast[], size_t tokens_count)
+{
+    char *view_apc[MAX_TOKENS] = {0};
+
+    for (size_t i = 0u; i < tokens_count; ++i)
+    {
+        view_apc[i] = (char *)(uintptr_t)tokens_ast[i].ptr_cp;
+    }
+
+    return sig_pst->exec_fn(view_apc);
+}
+
+/**
+ * @brief Validates and dispatches a command from tokenized input.
+ *
+ * @param sig_pst Pointer to the command signature.
+ * @param tokens_ast Array of tokens (command name + arguments).
+ * @param tokens_count Number of tokens on the line, including the command name.
+ * @param arena_pst Caller arena for blob arguments, or NULL to use the
+ *                  internal stack buffer of `MAX_ARG_CONTENT_SIZE` bytes.
+ *
+ * @return true if execution succeeded, false otherwise.
+ */
+static bool dispatch_command(const ce_signature_st *sig_pst, const ce_token_st tokens_ast[],
+                             size_t tokens_count, ce_arena_st *arena_pst)
+{
+    ce_arg_value_ut args_a[MAX_TOKENS] = {0};
+    uint8_t blob_storage[MAX_ARG_CONTENT_SIZE];
+    ce_arena_st scratch = {
+        .base_u8p = blob_storage,
+        .size = sizeof(blob_storage),
+        .used = 0u
+    };
+    uint32_t stats_start_u32;
+
+    if ((NULL == sig_pst) || (NULL == tokens_ast))
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
+        return false;
+    }
+
+#ifndef CE_STATS_ENABLE
+    /* Fused fast path: the generated ce_exec_<command>() inlines the exact
+     * parse sequence and handler call for this signature. Stats builds
+     * fall through to the generic path, which separates the parse and
+     * invoke phases the per-command counters need. A caller arena forces
+     * the generic path too: the generated blob buffers are fixed-size.
      */
-    if (in_token && (count == MAX_TOKENS))
+    if (NULL != sig_pst->exec_fn)
     {
-        while ((*ptr != '\0') && !IS_WHITESPACE(*ptr))
+        if (NULL == arena_pst)
         {
-            ptr++;
+            return run_exec_fn(sig_pst, tokens_ast, tokens_count);
+        }
+
+        /* Registered module commands still take the fused entry: the
+         * generated invoke switch cannot resolve them.
+         */
+        if (is_foreign_signature(sig_pst))
+        {
+            return run_exec_fn(sig_pst, tokens_ast, tokens_count);
         }
     }
+#else
+    /* Signatures from registered module tables are unknown to the
+     * generated ce_invoke_handler() switch and carry no stats counters
+     * either, so their fused entry is the only viable path even here.
+     */
+    if (is_foreign_signature(sig_pst) && (NULL != sig_pst->exec_fn))
+    {
+        return run_exec_fn(sig_pst, tokens_ast, tokens_count);
+    }
+#endif
 
-    /* Now skip and null-terminate trailing whitespace */
-    while ((*ptr != '\0') && IS_WHITESPACE(*ptr))
+    if (!parse_arguments(sig_pst, tokens_ast, tokens_count - ARG_OFFSET, args_a,
+                         (NULL != arena_pst) ? arena_pst : &scratch))
     {
-        *ptr = '\0';
-        ptr++;
+        CE_STATS_PARSE_FAIL(sig_pst);
+        LOG_ERR(CE_FILE_DISPATCH_e, "Failed to parse command arguments");
+        return false;
     }
 
-    if ((count == MAX_TOKENS) && (*ptr != '\0'))
+    stats_start_u32 = CE_STATS_TIMESTAMP();
+
+    if (!ce_invoke_handler(sig_pst, args_a, (uint8_t)(tokens_count - ARG_OFFSET)))
     {
-        LOG_ERR(CE_FILE_DISPATCH_e,
-                "Too many tokens, maximum allowed is %u, input truncated at token count %u",
-                (unsigned)MAX_TOKENS, (unsigned)count);
+        CE_STATS_ADD_CYCLES(sig_pst, CE_STATS_TIMESTAMP() - stats_start_u32);
         return false;
     }
 
-    *tokens_count = count;
+    CE_STATS_ADD_CYCLES(sig_pst, CE_STATS_TIMESTAMP() - stats_start_u32);
+    CE_STATS_DISPATCH(sig_pst);
+
     return true;
 }
 
+
 /**
- * @brief Validates and dispatches a command from tokenized input.
+ * @brief Tokenizes and dispatches a writable command line in-place.
  *
- * @param sig_pst Pointer to the command signature.
- * @param tokens_ca Array of argument string tokens (NULL-terminated or fixed).
+ * Shared tail of all dispatch entry points: splits the buffer into tokens,
+ * resolves the command hash, validates the argument count, and invokes the
+ * handler. The buffer is mutated by the in-place tokenizer.
  *
- * @return true if execution succeeded, false otherwise.
+ * @param line Writable, null-terminated command line (modified in-place).
+ * @param arena_pst Caller arena for blob arguments, or NULL for the
+ *                  internal stack buffer.
+ * @return true if dispatch and execution succeeded, false otherwise.
  */
-static bool dispatch_command(const ce_signature_st *sig_pst, char *tokens_ca[])
+static bool dispatch_tokens_arena(const ce_token_st tokens_ast[], size_t tokens_count,
+                                  ce_arena_st *arena_pst);
+
+static bool dispatch_line_buffer(char *line, ce_arena_st *arena_pst)
 {
-    ce_arg_value_ut args_a[MAX_TOKENS] = {0};
-    scratch_buffer_st scratch = { .used = 0u };
+    ce_token_st tokens_ast[MAX_TOKENS] = {0};
+    size_t tokens_count = 0u;
 
-    if ((NULL == sig_pst) || (NULL == tokens_ca))
+    if (!parse_line_to_tokens(line, tokens_ast, &tokens_count))
     {
-        LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
         return false;
     }
 
-    if (!parse_arguments(sig_pst, tokens_ca, args_a, &scratch))
+    return dispatch_tokens_arena(tokens_ast, tokens_count, arena_pst);
+}
+
+
+/**
+ * @brief Resolves, validates, and executes an already-tokenized command.
+ *
+ * @param tokens_ast   Token array, command name at index 0.
+ * @param tokens_count Number of valid entries in `tokens_ast`.
+ * @param arena_pst    Caller arena for blob arguments, or NULL for the
+ *                     internal stack buffer.
+ * @return true if dispatch and execution succeeded, false otherwise.
+ */
+static bool dispatch_tokens_arena(const ce_token_st tokens_ast[], size_t tokens_count,
+                                  ce_arena_st *arena_pst)
+{
+    uint32_t hash_u32;
+    const ce_signature_st *sig_pst;
+
+    if ((NULL == tokens_ast) || (0u == tokens_count) || (NULL == tokens_ast[0].ptr_cp))
     {
-        LOG_ERR(CE_FILE_DISPATCH_e, "Failed to parse command arguments");
+        LOG_ERR(CE_FILE_DISPATCH_e, "No command token found");
+        return false;
+    }
+
+    hash_u32 = ce_hash_calculate_n(tokens_ast[0].ptr_cp, tokens_ast[0].len_u16);
+    sig_pst = lookup_signature_by_hash(hash_u32);
+
+    if (NULL == sig_pst)
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Unknown command '%s' (hash=0x%08X)",
+                tokens_ast[0].ptr_cp, hash_u32);
         return false;
     }
 
-    if (!ce_invoke_handler(sig_pst, args_a))
+    if (!validate_argument_count(tokens_count, sig_pst))
+    {
+        return false;
+    }
+
+    if (!dispatch_command(sig_pst, tokens_ast, tokens_count, arena_pst))
     {
         return false;
     }
@@ -318,15 +642,21 @@ static bool dispatch_command(const ce_signature_st *sig_pst, char *tokens_ca[])
 }
 
 
+/* Internal entry for front-ends that already hold a token array (see
+ * ce_dispatch_internal.h). Resolves the command hash, validates the
+ * argument count, and invokes the handler.
+ */
+bool ce_dispatch_tokens(const ce_token_st tokens_ast[], size_t tokens_count)
+{
+    return dispatch_tokens_arena(tokens_ast, tokens_count, NULL);
+}
+
+
 /* Entry point of the command engine.
  * Parses a space-delimited input line and invokes the matching handler.
  */
 bool ce_dispatch_from_line(const char *line_str)
 {
-    char  *tokens_apc[MAX_TOKENS] = {0};
-    size_t tokens_count = 0u;
-    uint32_t hash_u32;
-    const ce_signature_st *sig_pst;
     char line_buf[MAX_LINE_BUF_SIZE] = {0};
 
     if (NULL == line_str)
@@ -344,40 +674,359 @@ bool ce_dispatch_from_line(const char *line_str)
     strncpy(line_buf, line_str, sizeof(line_buf) - 1u);
     line_buf[sizeof(line_buf) - 1u] = '\0';
 
-    if (!parse_line_to_tokens(line_buf, tokens_apc, &tokens_count))
+    return dispatch_line_buffer(line_buf, NULL);
+}
+
+
+/* Arena variant: binary arguments are decoded into the caller-provided
+ * bump allocator instead of the internal MAX_ARG_CONTENT_SIZE buffer.
+ */
+bool ce_dispatch_from_line_ex(const char *line_str, ce_arena_st *arena_pst)
+{
+    char line_buf[MAX_LINE_BUF_SIZE] = {0};
+
+    if ((NULL == line_str) || (NULL == arena_pst) ||
+        (NULL == arena_pst->base_u8p) || (arena_pst->used > arena_pst->size))
     {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
         return false;
     }
 
-    if ((0u == tokens_count) || (NULL == tokens_apc[0]))
+    if (strlen(line_str) >= sizeof(line_buf))
     {
-        LOG_ERR(CE_FILE_DISPATCH_e, "No command token found");
+        LOG_ERR(CE_FILE_DISPATCH_e, "Input line truncated");
         return false;
     }
 
-    hash_u32 = ce_hash_calculate(tokens_apc[0]);
+    strncpy(line_buf, line_str, sizeof(line_buf) - 1u);
+    line_buf[sizeof(line_buf) - 1u] = '\0';
+
+    return dispatch_line_buffer(line_buf, arena_pst);
+}
+
+
+/* Status-reporting variant: walks the same pipeline but returns the first
+ * failure cause as an enum and fills `info_pst` with integer stores only.
+ * Takes the generic parse path so parse failures are classified per token;
+ * only the invoke step of registered module commands goes through their
+ * fused exec entry, since the generic invoke cannot resolve them.
+ */
+ce_status_et ce_dispatch_from_line_status(const char *line_str, ce_error_info_st *info_pst)
+{
+    char line_buf[MAX_LINE_BUF_SIZE] = {0};
+    ce_token_st tokens_ast[MAX_TOKENS] = {0};
+    size_t tokens_count = 0u;
+    ce_arg_value_ut args_a[MAX_TOKENS] = {0};
+    uint8_t blob_storage[MAX_ARG_CONTENT_SIZE];
+    ce_arena_st scratch = {
+        .base_u8p = blob_storage,
+        .size = sizeof(blob_storage),
+        .used = 0u
+    };
+    uint32_t hash_u32;
+    const ce_signature_st *sig_pst;
+
+    if (NULL != info_pst)
+    {
+        info_pst->hash_u32 = 0u;
+        info_pst->token_idx_u8 = 0u;
+        info_pst->expected_u8 = 0u;
+        info_pst->got_u8 = 0u;
+    }
+
+    if ((NULL == line_str) || (strlen(line_str) >= sizeof(line_buf)))
+    {
+        return CE_STATUS_BAD_INPUT_e;
+    }
+
+    strncpy(line_buf, line_str, sizeof(line_buf) - 1u);
+    line_buf[sizeof(line_buf) - 1u] = '\0';
+
+    if (!parse_line_to_tokens(line_buf, tokens_ast, &tokens_count))
+    {
+        return CE_STATUS_BAD_INPUT_e;
+    }
+
+    if ((0u == tokens_count) || (NULL == tokens_ast[0].ptr_cp))
+    {
+        return CE_STATUS_BAD_INPUT_e;
+    }
+
+    hash_u32 = ce_hash_calculate_n(tokens_ast[0].ptr_cp, tokens_ast[0].len_u16);
+
+    if (NULL != info_pst)
+    {
+        info_pst->hash_u32 = hash_u32;
+    }
+
     sig_pst = lookup_signature_by_hash(hash_u32);
 
     if (NULL == sig_pst)
     {
-        LOG_ERR(CE_FILE_DISPATCH_e, "Unknown command '%s' (hash=0x%08X)", tokens_apc[0], hash_u32);
-        return false;
+        return CE_STATUS_UNKNOWN_COMMAND_e;
     }
 
     if (!validate_argument_count(tokens_count, sig_pst))
+    {
+        if (NULL != info_pst)
+        {
+            info_pst->expected_u8 = sig_pst->type_count_u8;
+            info_pst->got_u8 = (uint8_t)(tokens_count - 1u);
+        }
+        return CE_STATUS_ARG_COUNT_e;
+    }
+
+    {
+        /* Vectored signatures parse every present token with the trailing
+         * type; fixed-arity ones parse exactly the declared list.
+         */
+        size_t parse_count = (sig_pst->repeat_max_u8 > 0u)
+                                 ? (tokens_count - ARG_OFFSET)
+                                 : sig_pst->type_count_u8;
+
+        for (uint8_t i = 0u; i < parse_count; ++i)
+        {
+            const ce_token_st *token_pst = &tokens_ast[i + ARG_OFFSET];
+            ce_arg_type_et type_e = (i < sig_pst->type_count_u8)
+                                        ? sig_pst->types_e[i]
+                                        : sig_pst->types_e[sig_pst->type_count_u8 - 1u];
+
+            if ((NULL == token_pst->ptr_cp) ||
+                !parse_value_by_type(type_e, token_pst, &args_a[i], &scratch))
+            {
+                if (NULL != info_pst)
+                {
+                    info_pst->token_idx_u8 = (uint8_t)(i + ARG_OFFSET);
+                }
+                return CE_STATUS_PARSE_FAIL_e;
+            }
+        }
+    }
+
+    /* Registered module commands: the generated invoke switch cannot
+     * resolve foreign signatures, so replay the fused exec entry over the
+     * tokens. The parse pass above already classified argument errors
+     * precisely; the entry re-parses the same tokens, so a false from it
+     * is a handler failure.
+     */
+    if (is_foreign_signature(sig_pst) && (NULL != sig_pst->exec_fn))
+    {
+        if (!run_exec_fn(sig_pst, tokens_ast, tokens_count))
+        {
+            return CE_STATUS_HANDLER_FAIL_e;
+        }
+
+        return CE_STATUS_OK_e;
+    }
+
+    if (!ce_invoke_handler(sig_pst, args_a, (uint8_t)(tokens_count - ARG_OFFSET)))
+    {
+        return CE_STATUS_HANDLER_FAIL_e;
+    }
+
+    return CE_STATUS_OK_e;
+}
+
+
+/* Zero-copy entry point: tokenizes the caller's buffer directly.
+ * The buffer is destroyed (whitespace replaced by '\0') during tokenization.
+ */
+bool ce_dispatch_from_line_inplace(char *line, size_t len)
+{
+    if (NULL == line)
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
+        return false;
+    }
+
+    if (line[len] != '\0')
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Line not null-terminated at given length");
+        return false;
+    }
+
+    return dispatch_line_buffer(line, NULL);
+}
+
+
+/* Two-phase API: parse once into a self-contained object, invoke many times.
+ * Repeated dispatch of an identical line then skips tokenizing, hashing,
+ * lookup, and argument parsing entirely.
+ */
+bool ce_parse_line(const char *line_str, ce_parsed_cmd_st *out_pst)
+{
+    size_t tokens_count = 0u;
+    uint32_t hash_u32;
+    ce_arena_st scratch;
+
+    if ((NULL == line_str) || (NULL == out_pst))
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
+        return false;
+    }
+
+    if (strlen(line_str) >= sizeof(out_pst->line_ca))
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Input line truncated");
+        return false;
+    }
+
+    strncpy(out_pst->line_ca, line_str, sizeof(out_pst->line_ca) - 1u);
+    out_pst->line_ca[sizeof(out_pst->line_ca) - 1u] = '\0';
+
+    /* The token view lands in the object itself (pointers into line_ca),
+     * so ce_invoke_parsed() can replay the fused exec entry of commands
+     * the generic invoke switch cannot resolve.
+     */
+    if (!parse_line_to_tokens(out_pst->line_ca, out_pst->tokens_ast, &tokens_count))
     {
         return false;
     }
 
-    if (!dispatch_command(sig_pst, tokens_apc))
+    if ((0u == tokens_count) || (NULL == out_pst->tokens_ast[0].ptr_cp))
     {
+        LOG_ERR(CE_FILE_DISPATCH_e, "No command token found");
+        return false;
+    }
+
+    hash_u32 = ce_hash_calculate_n(out_pst->tokens_ast[0].ptr_cp,
+                                   out_pst->tokens_ast[0].len_u16);
+    out_pst->sig_pst = lookup_signature_by_hash(hash_u32);
+
+    if (NULL == out_pst->sig_pst)
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Unknown command '%s' (hash=0x%08X)",
+                out_pst->tokens_ast[0].ptr_cp, hash_u32);
         return false;
     }
 
+    if (!validate_argument_count(tokens_count, out_pst->sig_pst))
+    {
+        return false;
+    }
+
+    /* String tokens point into out_pst->line_ca; blobs decode into
+     * out_pst->blobs_ua — the object is self-contained afterwards.
+     */
+    scratch.base_u8p = out_pst->blobs_ua;
+    scratch.size = sizeof(out_pst->blobs_ua);
+    scratch.used = 0u;
+
+    if (!parse_arguments(out_pst->sig_pst, out_pst->tokens_ast, tokens_count - ARG_OFFSET,
+                         out_pst->args_a, &scratch))
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Failed to parse command arguments");
+        return false;
+    }
+
+    out_pst->arg_count_u8 = (uint8_t)(tokens_count - ARG_OFFSET);
+    out_pst->tokens_count_u8 = (uint8_t)tokens_count;
+
     return true;
 }
 
 
+bool ce_invoke_parsed(const ce_parsed_cmd_st *cmd_pst)
+{
+    if ((NULL == cmd_pst) || (NULL == cmd_pst->sig_pst))
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
+        return false;
+    }
+
+    /* Registered module commands: replay the fused exec entry over the
+     * stored token view — the generic invoke switch cannot resolve
+     * foreign signatures.
+     */
+    if (is_foreign_signature(cmd_pst->sig_pst))
+    {
+        if (NULL == cmd_pst->sig_pst->exec_fn)
+        {
+            LOG_ERR(CE_FILE_DISPATCH_e, "Registered command lacks an exec entry");
+            return false;
+        }
+
+        return run_exec_fn(cmd_pst->sig_pst, cmd_pst->tokens_ast,
+                           cmd_pst->tokens_count_u8);
+    }
+
+    return ce_invoke_handler(cmd_pst->sig_pst, cmd_pst->args_a, cmd_pst->arg_count_u8);
+}
+
+
+/* Batch entry point: dispatches every line of a newline-separated buffer
+ * in one pass, tokenizing each line in-place (no per-line copies).
+ */
+bool ce_dispatch_from_buffer(char *buf, size_t len, ce_batch_result_st *out_pst)
+{
+    ce_batch_result_st result = {
+        .dispatched_u32 = 0u,
+        .failed_u32 = 0u,
+        .first_error_offset = SIZE_MAX
+    };
+    size_t pos = 0u;
+
+    if (NULL == buf)
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
+        return false;
+    }
+
+    if (buf[len] != '\0')
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Buffer not null-terminated at given length");
+        return false;
+    }
+
+    while (pos < len)
+    {
+        size_t line_start = pos;
+        bool has_token = false;
+
+        /* Find end of line, noting whether it carries any non-whitespace */
+        while ((pos < len) && (buf[pos] != '\n'))
+        {
+            if (!IS_WHITESPACE(buf[pos]))
+            {
+                has_token = true;
+            }
+            pos++;
+        }
+
+        if (pos < len)
+        {
+            buf[pos] = '\0';  /* split line */
+            pos++;
+        }
+
+        if (!has_token)
+        {
+            continue;  /* skip blank lines silently */
+        }
+
+        if (dispatch_line_buffer(&buf[line_start], NULL))
+        {
+            result.dispatched_u32++;
+        }
+        else
+        {
+            result.failed_u32++;
+            if (SIZE_MAX == result.first_error_offset)
+            {
+                result.first_error_offset = line_start;
+            }
+        }
+    }
+
+    if (NULL != out_pst)
+    {
+        *out_pst = result;
+    }
+
+    return (0u == result.failed_u32);
+}
+
+
 #ifdef UNIT_TEST
 
 bool _test_validate_argument_count(int tokens_count, const ce_signature_st *sig_pst)
@@ -386,21 +1035,23 @@ bool _test_validate_argument_count(int tokens_count, const ce_signature_st *sig_
 }
 
 bool _test_parse_arguments(const ce_signature_st *sig_pst,
-                           char *tokens_ca[],
+                           const ce_token_st tokens_ast[],
+                           size_t arg_count,
                            ce_arg_value_ut out_args_a[MAX_TOKENS],
-                           scratch_buffer_st *scratch)
+                           ce_arena_st *scratch)
 {
-    return parse_arguments(sig_pst, tokens_ca, out_args_a, scratch);
+    return parse_arguments(sig_pst, tokens_ast, arg_count, out_args_a, scratch);
 }
 
-bool _test_parse_line_to_tokens(char *line, char *tokens[], size_t *tokens_count)
+bool _test_parse_line_to_tokens(char *line, ce_token_st tokens_ast[], size_t *tokens_count)
 {
-    return parse_line_to_tokens(line, tokens, tokens_count);
+    return parse_line_to_tokens(line, tokens_ast, tokens_count);
 }
 
-bool _test_dispatch_command(const ce_signature_st *sig_pst, char *tokens_ca[])
+bool _test_dispatch_command(const ce_signature_st *sig_pst, const ce_token_st tokens_ast[],
+                            size_t tokens_count)
 {
-    dispatch_command(sig_pst, tokens_ca);
+    return dispatch_command(sig_pst, tokens_ast, tokens_count, NULL);
 }
 
 const ce_signature_st* _test_lookup_signature_by_hash(uint32_t hash)
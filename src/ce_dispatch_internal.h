@@ -0,0 +1,42 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_dispatch_internal.h
+ * @brief Internal dispatcher entry points shared between engine modules.
+ *
+ * Not part of the public API: only front-ends living inside the engine
+ * (e.g., the streaming tokenizer in `ce_stream.c`) may include this.
+ */
+
+#ifndef CE_DISPATCH_INTERNAL_H
+#define CE_DISPATCH_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ce_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Dispatches a command from an already-tokenized line.
+ *
+ * Skips the tokenizer entirely: resolves the hash of `tokens_ast[0]`,
+ * validates the argument count against the signature, and invokes the
+ * handler. Token bytes must be null-terminated in a writable buffer (the
+ * usual output of in-place tokenization), with each entry's `len_u16`
+ * matching its string length — the dispatcher trusts the lengths and
+ * never re-scans the bytes.
+ *
+ * @param tokens_ast   Token pointer/length pairs, command name at index 0.
+ * @param tokens_count Number of valid entries in `tokens_ast`.
+ * @return true if dispatch and execution succeeded, false otherwise.
+ */
+bool ce_dispatch_tokens(const ce_token_st tokens_ast[], size_t tokens_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CE_DISPATCH_INTERNAL_H */
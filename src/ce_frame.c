@@ -0,0 +1,206 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_frame.c
+ * @brief Implements binary frame decoding and dispatch.
+ */
+
+#include <string.h>
+
+#include "logger.h"
+#include "ce_types.h"
+#include "ce_table.h"
+#include "ce_hash.h"
+#include "ce_invoke_handler.h"
+#include "ce_frame.h"
+
+#define FRAME_HASH_SIZE (4u)  /**< Little-endian u32 command hash */
+
+/**
+ * @brief Reads an unsigned little-endian integer of up to 8 bytes.
+ *
+ * @param p Frame position to read from.
+ * @param width Integer width in bytes (1, 2, 4, or 8).
+ * @return Decoded value, zero-extended to 64 bits.
+ */
+static uint64_t read_le(const uint8_t *p, size_t width)
+{
+    uint64_t value = 0u;
+
+    for (size_t i = 0u; i < width; ++i)
+    {
+        value |= ((uint64_t)p[i]) << (8u * i);
+    }
+
+    return value;
+}
+
+/**
+ * @brief Wire width in bytes for a fixed-size argument type.
+ *
+ * @param type_e Argument type.
+ * @return Width in bytes, or 0 for variable-length types (string/blob).
+ */
+static size_t wire_width(ce_arg_type_et type_e)
+{
+    switch (type_e)
+    {
+        case TYPE_UINT8_e:
+        case TYPE_INT8_e:
+        case TYPE_BOOL_e:
+            return 1u;
+
+        case TYPE_UINT16_e:
+        case TYPE_INT16_e:
+            return 2u;
+
+        case TYPE_UINT32_e:
+        case TYPE_INT32_e:
+            return 4u;
+
+        case TYPE_UINT64_e:
+        case TYPE_INT64_e:
+            return 8u;
+
+        default:
+            return 0u;  /* variable-length */
+    }
+}
+
+bool ce_dispatch_from_frame(const uint8_t *frame, size_t len)
+{
+    ce_arg_value_ut args_a[MAX_TOKENS] = {0};
+    char str_scratch[MAX_ARG_CONTENT_SIZE];
+    size_t str_used = 0u;
+    const ce_signature_st *sig_pst;
+    uint32_t hash_u32;
+    size_t pos;
+
+    if (NULL == frame)
+    {
+        LOG_ERR(CE_FILE_FRAME_e, "Null pointer");
+        return false;
+    }
+
+    if (len < FRAME_HASH_SIZE)
+    {
+        LOG_ERR(CE_FILE_FRAME_e, "Frame shorter than command hash");
+        return false;
+    }
+
+    hash_u32 = (uint32_t)read_le(frame, FRAME_HASH_SIZE);
+    sig_pst = ce_table_resolve_hash(hash_u32);
+
+    if (NULL == sig_pst)
+    {
+        LOG_ERR(CE_FILE_FRAME_e, "Unknown command hash 0x%08X", hash_u32);
+        return false;
+    }
+
+    /* Registered module signatures are text-only: their fused exec entry
+     * takes string tokens, and the generated ce_invoke_handler() switch
+     * cannot resolve foreign hashes, so there is no frame-capable invoke
+     * for them. Reject explicitly instead of decoding arguments that
+     * could never be delivered.
+     */
+    if ((sig_pst < ce_table_get_signatures()) ||
+        ((size_t)(sig_pst - ce_table_get_signatures()) >= ce_table_get_signatures_count()))
+    {
+        LOG_ERR(CE_FILE_FRAME_e, "Registered command is text-only, not framable (hash 0x%08X)",
+                hash_u32);
+        return false;
+    }
+
+    /* Vectored commands have no fixed frame layout; the text path with
+     * its explicit token count is the only transport for them.
+     */
+    if (sig_pst->repeat_max_u8 > 0u)
+    {
+        LOG_ERR(CE_FILE_FRAME_e, "Vectored command not framable (hash 0x%08X)", hash_u32);
+        return false;
+    }
+
+    pos = FRAME_HASH_SIZE;
+
+    for (uint8_t i = 0u; i < sig_pst->type_count_u8; ++i)
+    {
+        ce_arg_type_et type_e = sig_pst->types_e[i];
+        size_t width = wire_width(type_e);
+
+        if (width > 0u)
+        {
+            uint64_t raw;
+
+            if ((len - pos) < width)
+            {
+                LOG_ERR(CE_FILE_FRAME_e, "Frame truncated at argument %u", (unsigned)(i + 1u));
+                return false;
+            }
+
+            raw = read_le(&frame[pos], width);
+            pos += width;
+
+            switch (type_e)
+            {
+                case TYPE_UINT8_e:  args_a[i].u8 = (uint8_t)raw; break;
+                case TYPE_UINT16_e: args_a[i].u16 = (uint16_t)raw; break;
+                case TYPE_UINT32_e: args_a[i].u32 = (uint32_t)raw; break;
+                case TYPE_UINT64_e: args_a[i].u64 = raw; break;
+                case TYPE_INT8_e:   args_a[i].i8 = (int8_t)(uint8_t)raw; break;
+                case TYPE_INT16_e:  args_a[i].i16 = (int16_t)(uint16_t)raw; break;
+                case TYPE_INT32_e:  args_a[i].i32 = (int32_t)(uint32_t)raw; break;
+                case TYPE_INT64_e:  args_a[i].i64 = (int64_t)raw; break;
+                case TYPE_BOOL_e:   args_a[i].b = (raw != 0u); break;
+                default:            return false;  /* unreachable */
+            }
+        }
+        else
+        {
+            size_t blob_len;
+
+            if ((len - pos) < 1u)
+            {
+                LOG_ERR(CE_FILE_FRAME_e, "Frame truncated at argument %u", (unsigned)(i + 1u));
+                return false;
+            }
+
+            blob_len = frame[pos];
+            pos += 1u;
+
+            if ((len - pos) < blob_len)
+            {
+                LOG_ERR(CE_FILE_FRAME_e, "Frame truncated at argument %u", (unsigned)(i + 1u));
+                return false;
+            }
+
+            if (TYPE_STRING_e == type_e)
+            {
+                /* Copy once to gain a null terminator */
+                if ((blob_len + 1u) > (sizeof(str_scratch) - str_used))
+                {
+                    LOG_ERR(CE_FILE_FRAME_e, "String argument %u too large", (unsigned)(i + 1u));
+                    return false;
+                }
+
+                memcpy(&str_scratch[str_used], &frame[pos], blob_len);
+                str_scratch[str_used + blob_len] = '\0';
+                args_a[i].str_cp = &str_scratch[str_used];
+                str_used += blob_len + 1u;
+            }
+            else
+            {
+                /* Blobs are zero-copy: point straight into the frame */
+                args_a[i].bytes_u8p = &frame[pos];
+            }
+
+            pos += blob_len;
+        }
+    }
+
+    if (pos != len)
+    {
+        LOG_ERR(CE_FILE_FRAME_e, "Frame has %lu trailing bytes", (unsigned long)(len - pos));
+        return false;
+    }
+
+    return ce_invoke_handler(sig_pst, args_a, sig_pst->type_count_u8);
+}
@@ -30,3 +30,21 @@ uint32_t ce_hash_calculate(const char* str)
 
     return hash;
 }
+
+uint32_t ce_hash_calculate_n(const char* str, size_t len)
+{
+    uint32_t hash = DJB2_INIT_HASH;
+
+    if (NULL == str)
+    {
+        return 0u;
+    }
+
+    for (size_t i = 0u; i < len; ++i)
+    {
+        /* Equivalent to hash * 33 + c */
+        hash = ((hash << DJB2_HASH_SHIFT) + hash) + (uint32_t)str[i];
+    }
+
+    return hash;
+}
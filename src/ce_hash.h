@@ -12,6 +12,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
 
 /**
  * @brief DJB2 hash algorithm implementation (32-bit).
@@ -27,6 +28,19 @@ extern "C" {
  */
 uint32_t ce_hash_calculate(const char* str);
 
+/**
+ * @brief Length-taking DJB2 variant for tokens with a known size.
+ *
+ * Identical result to `ce_hash_calculate()` over the same bytes, but
+ * does not scan for the terminator — callers holding a `ce_token_st`
+ * avoid re-walking the command name.
+ *
+ * @param str Input bytes to hash (need not be null-terminated)
+ * @param len Number of bytes to hash
+ * @return Unsigned 32-bit hash result
+ */
+uint32_t ce_hash_calculate_n(const char* str, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
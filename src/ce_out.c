@@ -0,0 +1,151 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_out.c
+ * @brief Implements the bounded SPSC output ring for handler output.
+ *
+ * The ring stores raw bytes between a monotonically increasing write index
+ * (owned by the dispatch thread) and read index (owned by the drain task).
+ * Indices are published with release stores and observed with acquire
+ * loads, so no locks are needed for the single-producer single-consumer
+ * pairing.
+ *
+ * All state lives in the active engine context (see ce_ctx.h): each
+ * per-core context owns its own ring and indices.
+ */
+
+#include <string.h>
+
+#include "logger.h"
+#include "ce_out.h"
+#include "ce_ctx.h"
+
+#define OUT_MASK (CE_OUT_RING_SIZE - 1u)
+
+/* Atomic primitives: GCC/Clang builtins where available; plain accesses
+ * otherwise (valid only for single-threaded configurations).
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define OUT_LOAD_ACQ(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define OUT_LOAD_RLX(p)        __atomic_load_n((p), __ATOMIC_RELAXED)
+#define OUT_STORE_REL(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#warning "ce_out: no atomic builtins on this compiler, ring is single-threaded only!"
+#define OUT_LOAD_ACQ(p)        (*(p))
+#define OUT_LOAD_RLX(p)        (*(p))
+#define OUT_STORE_REL(p, v)    (*(p) = (v))
+#endif
+
+size_t ce_out_write(const uint8_t *data, size_t len)
+{
+    ce_out_state_st *state_pst = &ce_ctx_active()->out_st;
+    uint32_t wr;
+    uint32_t rd;
+    size_t space;
+    size_t first;
+
+    if (NULL == data)
+    {
+        LOG_ERR(CE_FILE_OUT_e, "Null pointer");
+        return 0u;
+    }
+
+    wr = OUT_LOAD_RLX(&state_pst->write_u32);
+    rd = OUT_LOAD_ACQ(&state_pst->read_u32);
+    space = (size_t)(CE_OUT_RING_SIZE - (wr - rd));
+
+    if (len > space)
+    {
+        LOG_ERR(CE_FILE_OUT_e, "Output ring full, %lu bytes dropped",
+                (unsigned long)(len - space));
+        len = space;
+    }
+
+    if (0u == len)
+    {
+        return 0u;
+    }
+
+    /* Copy in up to two segments around the ring wrap */
+    first = (size_t)(CE_OUT_RING_SIZE - (wr & OUT_MASK));
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(&state_pst->ring_ua[wr & OUT_MASK], data, first);
+    memcpy(&state_pst->ring_ua[0], &data[first], len - first);
+
+    /* Publish: the bytes become visible to the drain task */
+    OUT_STORE_REL(&state_pst->write_u32, wr + (uint32_t)len);
+
+    return len;
+}
+
+size_t ce_out_write_str(const char *str_cp)
+{
+    if (NULL == str_cp)
+    {
+        LOG_ERR(CE_FILE_OUT_e, "Null pointer");
+        return 0u;
+    }
+
+    return ce_out_write((const uint8_t *)str_cp, strlen(str_cp));
+}
+
+size_t ce_out_drain(ce_out_sink_fn_t sink)
+{
+    ce_out_state_st *state_pst = &ce_ctx_active()->out_st;
+    uint32_t rd;
+    uint32_t wr;
+    size_t pending;
+    size_t first;
+    size_t taken;
+    size_t total = 0u;
+
+    if (NULL == sink)
+    {
+        LOG_ERR(CE_FILE_OUT_e, "Null pointer");
+        return 0u;
+    }
+
+    rd = OUT_LOAD_RLX(&state_pst->read_u32);
+    wr = OUT_LOAD_ACQ(&state_pst->write_u32);
+    pending = (size_t)(wr - rd);
+
+    while (pending > 0u)
+    {
+        first = (size_t)(CE_OUT_RING_SIZE - (rd & OUT_MASK));
+        if (first > pending)
+        {
+            first = pending;
+        }
+
+        taken = sink(&state_pst->ring_ua[rd & OUT_MASK], first);
+        if (taken > first)
+        {
+            taken = first;
+        }
+
+        rd += (uint32_t)taken;
+        total += taken;
+        pending -= taken;
+
+        /* Recycle: consumed bytes become free space for the producer */
+        OUT_STORE_REL(&state_pst->read_u32, rd);
+
+        if (taken < first)
+        {
+            break;  /* transport back-pressure: stop early */
+        }
+    }
+
+    return total;
+}
+
+size_t ce_out_pending(void)
+{
+    ce_out_state_st *state_pst = &ce_ctx_active()->out_st;
+    uint32_t wr = OUT_LOAD_RLX(&state_pst->write_u32);
+    uint32_t rd = OUT_LOAD_RLX(&state_pst->read_u32);
+
+    return (size_t)(wr - rd);
+}
@@ -0,0 +1,203 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_queue.c
+ * @brief Implements the bounded lock-free MPSC command queue.
+ *
+ * The ring follows the classic sequence-number MPSC design: each slot
+ * carries a sequence counter that encodes whether it is free, being
+ * written, or ready for the consumer. Producers claim a slot with one CAS
+ * on the tail; the single consumer advances the head without any atomic
+ * read-modify-write.
+ */
+
+#include <string.h>
+
+#include "logger.h"
+#include "ce_types.h"
+#include "ce_dispatch.h"
+#include "ce_queue.h"
+
+#ifndef CE_QUEUE_DEPTH
+#define CE_QUEUE_DEPTH (16u)  /**< Slot count; must be a power of two */
+#endif
+
+#if (CE_QUEUE_DEPTH & (CE_QUEUE_DEPTH - 1u)) != 0u
+#error "CE_QUEUE_DEPTH must be a power of two"
+#endif
+
+#define QUEUE_MASK (CE_QUEUE_DEPTH - 1u)
+
+/* Atomic primitives: GCC/Clang builtins where available; plain accesses
+ * otherwise (valid only for single-threaded configurations).
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define QUEUE_LOAD_ACQ(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define QUEUE_LOAD_RLX(p)        __atomic_load_n((p), __ATOMIC_RELAXED)
+#define QUEUE_STORE_REL(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define QUEUE_CAS_RLX(p, e, v)   __atomic_compare_exchange_n((p), (e), (v), true, \
+                                                             __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#else
+#warning "ce_queue: no atomic builtins on this compiler, queue is single-threaded only!"
+#define QUEUE_LOAD_ACQ(p)        (*(p))
+#define QUEUE_LOAD_RLX(p)        (*(p))
+#define QUEUE_STORE_REL(p, v)    (*(p) = (v))
+static inline bool queue_cas_plain(uint32_t *p, uint32_t *expected, uint32_t desired)
+{
+    if (*p == *expected)
+    {
+        *p = desired;
+        return true;
+    }
+    *expected = *p;
+    return false;
+}
+#define QUEUE_CAS_RLX(p, e, v)   queue_cas_plain((p), (e), (v))
+#endif
+
+/**
+ * @brief A single queue slot holding one copied command line.
+ */
+typedef struct {
+    uint32_t seq_u32;                /**< Slot state sequence counter */
+    uint16_t len_u16;                /**< Line length, excluding terminator */
+    char line_ca[MAX_LINE_BUF_SIZE]; /**< Copied, null-terminated line */
+} queue_slot_st;
+
+static queue_slot_st queue_slots[CE_QUEUE_DEPTH];
+static uint32_t queue_tail_u32 = 0u;  /* next slot producers claim */
+static uint32_t queue_head_u32 = 0u;  /* next slot the consumer reads */
+
+/* Init gate states: the seeding pass must run exactly once even when the
+ * very first submits race from several producer threads.
+ */
+#define QUEUE_INIT_NONE_u32     (0u)
+#define QUEUE_INIT_SEEDING_u32  (1u)
+#define QUEUE_INIT_READY_u32    (2u)
+
+static uint32_t queue_init_state_u32 = QUEUE_INIT_NONE_u32;
+
+/**
+ * @brief Lazily seeds each slot's sequence number with its own index.
+ *
+ * Runs on the first submit/drain call. The gate is an atomic tri-state:
+ * one caller wins the CAS and seeds the ring, concurrent first callers
+ * spin until the seeding pass is published. A plain once-flag is not
+ * enough here — a second seeding pass would overwrite sequence numbers
+ * of slots the winner's caller already claimed and published, losing the
+ * command and wedging the slot once the tail laps.
+ */
+static void queue_lazy_init(void)
+{
+    uint32_t expected = QUEUE_INIT_NONE_u32;
+
+    if (QUEUE_INIT_READY_u32 == QUEUE_LOAD_ACQ(&queue_init_state_u32))
+    {
+        return;
+    }
+
+    if (QUEUE_CAS_RLX(&queue_init_state_u32, &expected, QUEUE_INIT_SEEDING_u32))
+    {
+        for (uint32_t i = 0u; i < CE_QUEUE_DEPTH; ++i)
+        {
+            QUEUE_STORE_REL(&queue_slots[i].seq_u32, i);
+        }
+        QUEUE_STORE_REL(&queue_init_state_u32, QUEUE_INIT_READY_u32);
+    }
+    else
+    {
+        while (QUEUE_INIT_READY_u32 != QUEUE_LOAD_ACQ(&queue_init_state_u32))
+        {
+            /* another thread is seeding; wait for it to publish */
+        }
+    }
+}
+
+bool ce_queue_submit(const char *line_str)
+{
+    size_t len;
+    uint32_t pos;
+
+    if (NULL == line_str)
+    {
+        LOG_ERR(CE_FILE_QUEUE_e, "Null pointer");
+        return false;
+    }
+
+    len = strlen(line_str);
+    if (len >= MAX_LINE_BUF_SIZE)
+    {
+        LOG_ERR(CE_FILE_QUEUE_e, "Line too long for queue slot (%lu bytes)",
+                (unsigned long)len);
+        return false;
+    }
+
+    queue_lazy_init();
+
+    pos = QUEUE_LOAD_RLX(&queue_tail_u32);
+
+    for (;;)
+    {
+        queue_slot_st *slot = &queue_slots[pos & QUEUE_MASK];
+        uint32_t seq = QUEUE_LOAD_ACQ(&slot->seq_u32);
+        int32_t diff = (int32_t)(seq - pos);
+
+        if (0 == diff)
+        {
+            /* Slot free: claim it by advancing the tail */
+            if (QUEUE_CAS_RLX(&queue_tail_u32, &pos, pos + 1u))
+            {
+                memcpy(slot->line_ca, line_str, len + 1u);
+                slot->len_u16 = (uint16_t)len;
+                /* Publish: mark slot ready for the consumer */
+                QUEUE_STORE_REL(&slot->seq_u32, pos + 1u);
+                return true;
+            }
+            /* CAS failed: pos was reloaded, retry with the new tail */
+        }
+        else if (diff < 0)
+        {
+            LOG_ERR(CE_FILE_QUEUE_e, "Queue full, command dropped");
+            return false;
+        }
+        else
+        {
+            /* Another producer is ahead of us; re-read the tail */
+            pos = QUEUE_LOAD_RLX(&queue_tail_u32);
+        }
+    }
+}
+
+size_t ce_queue_drain(void)
+{
+    size_t drained = 0u;
+
+    queue_lazy_init();
+
+    for (;;)
+    {
+        uint32_t pos = queue_head_u32;
+        queue_slot_st *slot = &queue_slots[pos & QUEUE_MASK];
+        uint32_t seq = QUEUE_LOAD_ACQ(&slot->seq_u32);
+
+        if (seq != (pos + 1u))
+        {
+            break;  /* next slot not ready: queue drained */
+        }
+
+        (void)ce_dispatch_from_line_inplace(slot->line_ca, slot->len_u16);
+        drained++;
+
+        /* Recycle: slot becomes free for the producer one lap ahead */
+        QUEUE_STORE_REL(&slot->seq_u32, pos + CE_QUEUE_DEPTH);
+        queue_head_u32 = pos + 1u;
+    }
+
+    return drained;
+}
+
+size_t ce_queue_pending(void)
+{
+    uint32_t tail = QUEUE_LOAD_RLX(&queue_tail_u32);
+
+    return (size_t)(tail - queue_head_u32);
+}
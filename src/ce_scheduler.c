@@ -0,0 +1,102 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_scheduler.c
+ * @brief Implements the cooperative scheduler for long-running commands.
+ *
+ * A fixed array of resume slots keeps the zero-malloc guarantee; slots
+ * free up as soon as their command stops returning `CE_LONG_CONTINUE_e`.
+ * Single-threaded by design, like the dispatcher it serves: defer happens
+ * inside a handler, ticks run from the same main loop.
+ */
+
+#include <stddef.h>
+
+#include "logger.h"
+#include "ce_scheduler.h"
+
+#ifndef CE_SCHEDULER_SLOTS
+#define CE_SCHEDULER_SLOTS (4u)  /**< Maximum concurrently deferred commands */
+#endif
+
+static ce_resume_fn_t sched_slots[CE_SCHEDULER_SLOTS];
+
+bool ce_scheduler_defer(ce_resume_fn_t resume_fn)
+{
+    if (NULL == resume_fn)
+    {
+        LOG_ERR(CE_FILE_SCHEDULER_e, "Null pointer");
+        return false;
+    }
+
+    for (size_t i = 0u; i < CE_SCHEDULER_SLOTS; ++i)
+    {
+        if (NULL == sched_slots[i])
+        {
+            sched_slots[i] = resume_fn;
+            return true;
+        }
+    }
+
+    LOG_ERR(CE_FILE_SCHEDULER_e, "Scheduler full (%u slots)",
+            (unsigned)CE_SCHEDULER_SLOTS);
+    return false;
+}
+
+size_t ce_scheduler_tick(void)
+{
+    size_t pending = 0u;
+
+    for (size_t i = 0u; i < CE_SCHEDULER_SLOTS; ++i)
+    {
+        ce_long_status_et status_e;
+
+        if (NULL == sched_slots[i])
+        {
+            continue;
+        }
+
+        status_e = sched_slots[i]();
+
+        if (CE_LONG_CONTINUE_e == status_e)
+        {
+            pending++;
+            continue;
+        }
+
+        if (CE_LONG_FAIL_e == status_e)
+        {
+            LOG_ERR(CE_FILE_SCHEDULER_e, "Deferred command failed");
+        }
+
+        sched_slots[i] = NULL;  /* retired: DONE or FAIL */
+    }
+
+    return pending;
+}
+
+size_t ce_scheduler_pending(void)
+{
+    size_t pending = 0u;
+
+    for (size_t i = 0u; i < CE_SCHEDULER_SLOTS; ++i)
+    {
+        if (NULL != sched_slots[i])
+        {
+            pending++;
+        }
+    }
+
+    return pending;
+}
+
+#ifdef UNIT_TEST
+
+void _test_scheduler_reset(void)
+{
+    for (size_t i = 0u; i < CE_SCHEDULER_SLOTS; ++i)
+    {
+        sched_slots[i] = NULL;
+    }
+}
+
+#endif /* UNIT_TEST */
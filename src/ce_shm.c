@@ -0,0 +1,407 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_shm.c
+ * @brief Implements the POSIX shared-memory command channel.
+ *
+ * The mapped region holds a ring header followed by the slot array. The
+ * ring itself is the same sequence-number MPSC design as ce_queue.c,
+ * with the sequence counters, tail, and head living in shared memory so
+ * the CAS-based slot claim works across process boundaries. The
+ * consumer defensively bounds and re-terminates each line before
+ * dispatch, and keeps the ring geometry and its head cursor in private
+ * memory: producers are other processes and their writes are not
+ * trusted.
+ */
+
+#ifdef CE_SHM_ENABLE
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "logger.h"
+#include "ce_types.h"
+#include "ce_dispatch.h"
+#include "ce_shm.h"
+
+/* Atomic primitives: GCC/Clang builtins where available; plain accesses
+ * otherwise (valid only for single-process configurations).
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define SHM_LOAD_ACQ(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define SHM_LOAD_RLX(p)        __atomic_load_n((p), __ATOMIC_RELAXED)
+#define SHM_STORE_REL(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define SHM_CAS_RLX(p, e, v)   __atomic_compare_exchange_n((p), (e), (v), true, \
+                                                           __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#else
+#warning "ce_shm: no atomic builtins on this compiler, channel is single-process only!"
+#define SHM_LOAD_ACQ(p)        (*(p))
+#define SHM_LOAD_RLX(p)        (*(p))
+#define SHM_STORE_REL(p, v)    (*(p) = (v))
+static inline bool shm_cas_plain(uint32_t *p, uint32_t *expected, uint32_t desired)
+{
+    if (*p == *expected)
+    {
+        *p = desired;
+        return true;
+    }
+    *expected = *p;
+    return false;
+}
+#define SHM_CAS_RLX(p, e, v)   shm_cas_plain((p), (e), (v))
+#endif
+
+#define SHM_MAGIC_U32 (0x43455348u)  /**< "CESH": layout/endianness probe */
+#define SHM_NAME_MAX  (64u)          /**< Longest accepted channel name */
+
+/**
+ * @brief A single shared slot holding one copied command line.
+ */
+typedef struct {
+    uint32_t seq_u32;                /**< Slot state sequence counter */
+    uint16_t len_u16;                /**< Line length, excluding terminator */
+    char line_ca[MAX_LINE_BUF_SIZE]; /**< Copied, null-terminated line */
+} shm_slot_st;
+
+/**
+ * @brief Ring header at the start of the mapping, shared by all processes.
+ */
+typedef struct {
+    uint32_t magic_u32;      /**< SHM_MAGIC_U32 once the ring is initialized */
+    uint32_t slot_count_u32; /**< Power-of-two slot count fixed at creation */
+    uint32_t line_size_u32;  /**< MAX_LINE_BUF_SIZE of the creator (must match) */
+    uint32_t tail_u32;       /**< Next slot producers claim (CAS) */
+    uint32_t head_u32;       /**< Next slot the consumer reads */
+    shm_slot_st slots_ast[]; /**< Slot array, slot_count_u32 entries */
+} shm_channel_st;
+
+static shm_channel_st *shm_channel_pst = NULL;
+static size_t shm_map_size = 0u;
+static bool shm_creator_b = false;
+static char shm_name_ca[SHM_NAME_MAX];
+
+/* Ring geometry and the consumer's cursor live in process-private memory,
+ * captured once at create/open after validation. The shared header copies
+ * are producer-writable, so re-reading them on every iteration would let
+ * a hostile producer change the index mask mid-drain and drive the slot
+ * accesses out of bounds.
+ */
+static uint32_t shm_slot_count_u32 = 0u;
+static uint32_t shm_head_u32 = 0u;
+
+/**
+ * @brief Computes the mapping size for a given slot count.
+ */
+static size_t shm_region_size(size_t slots)
+{
+    return sizeof(shm_channel_st) + (slots * sizeof(shm_slot_st));
+}
+
+/**
+ * @brief Validates a channel name for POSIX shm and local storage.
+ */
+static bool shm_name_valid(const char *name_str)
+{
+    return (NULL != name_str) && ('/' == name_str[0]) &&
+           (strlen(name_str) < sizeof(shm_name_ca));
+}
+
+bool ce_shm_channel_create(const char *name_str, size_t slots)
+{
+    int fd;
+    void *map;
+    size_t size;
+
+    if (!shm_name_valid(name_str))
+    {
+        LOG_ERR(CE_FILE_SHM_e, "Invalid channel name");
+        return false;
+    }
+
+    if ((0u == slots) || (0u != (slots & (slots - 1u))))
+    {
+        LOG_ERR(CE_FILE_SHM_e, "Slot count must be a power of two (got %lu)",
+                (unsigned long)slots);
+        return false;
+    }
+
+    if (NULL != shm_channel_pst)
+    {
+        LOG_ERR(CE_FILE_SHM_e, "Channel already mapped");
+        return false;
+    }
+
+    /* Re-create from scratch so a stale ring from a crashed daemon
+     * cannot leak half-written slots into the new session.
+     */
+    (void)shm_unlink(name_str);
+
+    fd = shm_open(name_str, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        LOG_ERR(CE_FILE_SHM_e, "shm_open failed");
+        return false;
+    }
+
+    size = shm_region_size(slots);
+    if (0 != ftruncate(fd, (off_t)size))
+    {
+        LOG_ERR(CE_FILE_SHM_e, "ftruncate to %lu bytes failed", (unsigned long)size);
+        (void)close(fd);
+        (void)shm_unlink(name_str);
+        return false;
+    }
+
+    map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);  /* mapping keeps the object alive */
+    if (MAP_FAILED == map)
+    {
+        LOG_ERR(CE_FILE_SHM_e, "mmap failed");
+        (void)shm_unlink(name_str);
+        return false;
+    }
+
+    shm_channel_pst = (shm_channel_st *)map;
+    shm_map_size = size;
+    shm_creator_b = true;
+    shm_slot_count_u32 = (uint32_t)slots;
+    shm_head_u32 = 0u;
+    (void)strcpy(shm_name_ca, name_str);
+
+    shm_channel_pst->slot_count_u32 = (uint32_t)slots;
+    shm_channel_pst->line_size_u32 = MAX_LINE_BUF_SIZE;
+    shm_channel_pst->tail_u32 = 0u;
+    shm_channel_pst->head_u32 = 0u;
+
+    for (uint32_t i = 0u; i < (uint32_t)slots; ++i)
+    {
+        SHM_STORE_REL(&shm_channel_pst->slots_ast[i].seq_u32, i);
+    }
+
+    /* Publish last: producers polling the magic see a complete ring */
+    SHM_STORE_REL(&shm_channel_pst->magic_u32, SHM_MAGIC_U32);
+    return true;
+}
+
+bool ce_shm_channel_open(const char *name_str)
+{
+    int fd;
+    void *map;
+    struct stat st;
+    const shm_channel_st *hdr;
+    uint32_t slots;
+
+    if (!shm_name_valid(name_str))
+    {
+        LOG_ERR(CE_FILE_SHM_e, "Invalid channel name");
+        return false;
+    }
+
+    if (NULL != shm_channel_pst)
+    {
+        LOG_ERR(CE_FILE_SHM_e, "Channel already mapped");
+        return false;
+    }
+
+    fd = shm_open(name_str, O_RDWR, 0u);
+    if (fd < 0)
+    {
+        LOG_ERR(CE_FILE_SHM_e, "shm_open failed");
+        return false;
+    }
+
+    if ((0 != fstat(fd, &st)) || (st.st_size < (off_t)sizeof(shm_channel_st)))
+    {
+        LOG_ERR(CE_FILE_SHM_e, "Channel object truncated");
+        (void)close(fd);
+        return false;
+    }
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (MAP_FAILED == map)
+    {
+        LOG_ERR(CE_FILE_SHM_e, "mmap failed");
+        return false;
+    }
+
+    hdr = (const shm_channel_st *)map;
+    slots = hdr->slot_count_u32;  /* read once; validated below, cached after */
+    if ((SHM_MAGIC_U32 != SHM_LOAD_ACQ(&hdr->magic_u32)) ||
+        (MAX_LINE_BUF_SIZE != hdr->line_size_u32) ||
+        (0u == slots) || (0u != (slots & (slots - 1u))) ||
+        ((size_t)st.st_size < shm_region_size(slots)))
+    {
+        LOG_ERR(CE_FILE_SHM_e, "Channel layout mismatch");
+        (void)munmap(map, (size_t)st.st_size);
+        return false;
+    }
+
+    shm_channel_pst = (shm_channel_st *)map;
+    shm_map_size = (size_t)st.st_size;
+    shm_creator_b = false;
+    shm_slot_count_u32 = slots;
+    shm_head_u32 = 0u;
+    (void)strcpy(shm_name_ca, name_str);
+    return true;
+}
+
+bool ce_shm_submit(const char *line_str)
+{
+    size_t len;
+    uint32_t pos;
+    uint32_t mask;
+
+    if (NULL == shm_channel_pst)
+    {
+        LOG_ERR(CE_FILE_SHM_e, "No channel mapped");
+        return false;
+    }
+
+    if (NULL == line_str)
+    {
+        LOG_ERR(CE_FILE_SHM_e, "Null pointer");
+        return false;
+    }
+
+    len = strlen(line_str);
+    if (len >= MAX_LINE_BUF_SIZE)
+    {
+        LOG_ERR(CE_FILE_SHM_e, "Line too long for channel slot (%lu bytes)",
+                (unsigned long)len);
+        return false;
+    }
+
+    mask = shm_slot_count_u32 - 1u;
+    pos = SHM_LOAD_RLX(&shm_channel_pst->tail_u32);
+
+    for (;;)
+    {
+        shm_slot_st *slot = &shm_channel_pst->slots_ast[pos & mask];
+        uint32_t seq = SHM_LOAD_ACQ(&slot->seq_u32);
+        int32_t diff = (int32_t)(seq - pos);
+
+        if (0 == diff)
+        {
+            /* Slot free: claim it by advancing the tail */
+            if (SHM_CAS_RLX(&shm_channel_pst->tail_u32, &pos, pos + 1u))
+            {
+                memcpy(slot->line_ca, line_str, len + 1u);
+                slot->len_u16 = (uint16_t)len;
+                /* Publish: mark slot ready for the consumer */
+                SHM_STORE_REL(&slot->seq_u32, pos + 1u);
+                return true;
+            }
+            /* CAS failed: pos was reloaded, retry with the new tail */
+        }
+        else if (diff < 0)
+        {
+            LOG_ERR(CE_FILE_SHM_e, "Channel full, command dropped");
+            return false;
+        }
+        else
+        {
+            /* Another producer is ahead of us; re-read the tail */
+            pos = SHM_LOAD_RLX(&shm_channel_pst->tail_u32);
+        }
+    }
+}
+
+size_t ce_shm_drain(void)
+{
+    size_t drained = 0u;
+    uint32_t mask;
+
+    if (NULL == shm_channel_pst)
+    {
+        return 0u;
+    }
+
+    mask = shm_slot_count_u32 - 1u;
+
+    for (;;)
+    {
+        uint32_t pos = shm_head_u32;
+        shm_slot_st *slot = &shm_channel_pst->slots_ast[pos & mask];
+        uint32_t seq = SHM_LOAD_ACQ(&slot->seq_u32);
+        size_t len;
+
+        if (seq != (pos + 1u))
+        {
+            break;  /* next slot not ready: channel drained */
+        }
+
+        /* Foreign writer: clamp the length and force termination before
+         * handing the line to the parser.
+         */
+        len = slot->len_u16;
+        if (len >= MAX_LINE_BUF_SIZE)
+        {
+            len = MAX_LINE_BUF_SIZE - 1u;
+        }
+        slot->line_ca[len] = '\0';
+
+        (void)ce_dispatch_from_line_inplace(slot->line_ca, len);
+        drained++;
+
+        /* Recycle: slot becomes free for the producer one lap ahead */
+        SHM_STORE_REL(&slot->seq_u32, pos + shm_slot_count_u32);
+        shm_head_u32 = pos + 1u;
+
+        /* Advisory mirror for producer-side ce_shm_pending(); the
+         * consumer never reads it back.
+         */
+        SHM_STORE_REL(&shm_channel_pst->head_u32, pos + 1u);
+    }
+
+    return drained;
+}
+
+size_t ce_shm_pending(void)
+{
+    uint32_t tail;
+    uint32_t head;
+
+    if (NULL == shm_channel_pst)
+    {
+        return 0u;
+    }
+
+    tail = SHM_LOAD_RLX(&shm_channel_pst->tail_u32);
+
+    /* The consumer trusts only its private cursor; producers read the
+     * advisory mirror the consumer publishes (informational either way).
+     */
+    head = shm_creator_b ? shm_head_u32 : SHM_LOAD_RLX(&shm_channel_pst->head_u32);
+
+    return (size_t)(tail - head);
+}
+
+void ce_shm_channel_close(void)
+{
+    if (NULL == shm_channel_pst)
+    {
+        return;
+    }
+
+    (void)munmap(shm_channel_pst, shm_map_size);
+    if (shm_creator_b)
+    {
+        (void)shm_unlink(shm_name_ca);
+    }
+
+    shm_channel_pst = NULL;
+    shm_map_size = 0u;
+    shm_creator_b = false;
+    shm_slot_count_u32 = 0u;
+    shm_head_u32 = 0u;
+}
+
+#else /* !CE_SHM_ENABLE */
+
+/* Keep the translation unit non-empty when the feature is compiled out */
+typedef int ce_shm_disabled_t;
+
+#endif /* CE_SHM_ENABLE */
@@ -0,0 +1,113 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_stats.c
+ * @brief Implements the optional per-command statistics counters.
+ *
+ * The counter array parallels the generated signature table: the index of
+ * a signature within `ce_table_get_signatures()` selects its counter
+ * block. The whole translation unit is empty unless `CE_STATS_ENABLE` is
+ * defined.
+ *
+ * All state lives in the active engine context (see ce_ctx.h): each
+ * per-core context accumulates its own counters.
+ */
+
+#include "ce_stats.h"
+
+#ifdef CE_STATS_ENABLE
+
+#include <string.h>
+
+#include "ce_table.h"
+#include "ce_command_ids.h"
+#include "ce_ctx.h"
+
+/**
+ * @brief Maps a signature pointer to its counter block.
+ *
+ * @param sig_pst Pointer into the generated signature table.
+ * @return Counter block, or NULL for foreign/out-of-range pointers.
+ */
+static ce_stats_entry_st *stats_entry_for(const ce_signature_st *sig_pst)
+{
+    const ce_signature_st *table = ce_table_get_signatures();
+    size_t idx;
+
+    if ((NULL == sig_pst) || (sig_pst < table))
+    {
+        return NULL;
+    }
+
+    idx = (size_t)(sig_pst - table);
+    if (idx >= CE_CMD_COUNT)
+    {
+        return NULL;
+    }
+
+    return &ce_ctx_active()->stats_st.entries_ast[idx];
+}
+
+void ce_stats_set_timestamp_hook(ce_stats_timestamp_fn_t fn)
+{
+    ce_ctx_active()->stats_st.timestamp_fn = fn;
+}
+
+void ce_stats_on_dispatch(const ce_signature_st *sig_pst)
+{
+    ce_stats_entry_st *entry = stats_entry_for(sig_pst);
+
+    if (NULL != entry)
+    {
+        entry->dispatch_count_u32++;
+    }
+}
+
+void ce_stats_on_parse_fail(const ce_signature_st *sig_pst)
+{
+    ce_stats_entry_st *entry = stats_entry_for(sig_pst);
+
+    if (NULL != entry)
+    {
+        entry->parse_fail_count_u32++;
+    }
+}
+
+void ce_stats_add_cycles(const ce_signature_st *sig_pst, uint32_t delta_u32)
+{
+    ce_stats_entry_st *entry = stats_entry_for(sig_pst);
+
+    if (NULL != entry)
+    {
+        entry->handler_cycles_u64 += delta_u32;
+    }
+}
+
+uint32_t ce_stats_timestamp(void)
+{
+    ce_stats_timestamp_fn_t fn = ce_ctx_active()->stats_st.timestamp_fn;
+
+    return (NULL != fn) ? fn() : 0u;
+}
+
+size_t ce_stats_snapshot(ce_stats_entry_st *out_a, size_t max_entries)
+{
+    ce_stats_state_st *state_pst = &ce_ctx_active()->stats_st;
+    size_t count = (max_entries < CE_CMD_COUNT) ? max_entries : (size_t)CE_CMD_COUNT;
+
+    if (NULL == out_a)
+    {
+        return 0u;
+    }
+
+    memcpy(out_a, state_pst->entries_ast, count * sizeof(state_pst->entries_ast[0]));
+    return count;
+}
+
+void ce_stats_reset(void)
+{
+    ce_stats_state_st *state_pst = &ce_ctx_active()->stats_st;
+
+    memset(state_pst->entries_ast, 0, sizeof(state_pst->entries_ast));
+}
+
+#endif /* CE_STATS_ENABLE */
@@ -0,0 +1,152 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_stream.c
+ * @brief Implements the incremental streaming tokenizer front-end.
+ *
+ * The classic path accumulates a full line, then `ce_dispatch_from_line()`
+ * copies and re-scans it from scratch. Here tokenization overlaps
+ * reception instead: each fed byte is classified once — separators close
+ * the current token with a '\0', printable bytes open or extend one — so
+ * the token array is already complete when the terminator arrives and
+ * dispatch starts immediately via `ce_dispatch_tokens()`.
+ */
+
+#include <stdbool.h>
+
+#include "logger.h"
+#include "ce_types.h"
+#include "ce_stream.h"
+#include "ce_dispatch_internal.h"
+
+#define STREAM_IS_SEPARATOR(c)   (((c) == ' ') || ((c) == '\t'))
+#define STREAM_IS_TERMINATOR(c)  (((c) == '\n') || ((c) == '\r'))
+
+/**
+ * @brief Carry-over tokenizer state between `ce_feed()` calls.
+ */
+typedef struct {
+    char line_ca[MAX_LINE_BUF_SIZE];   /**< Assembled token bytes ('\0'-separated) */
+    ce_token_st tokens_ast[MAX_TOKENS]; /**< Token pointer/length pairs into line_ca */
+    size_t used;                       /**< Bytes consumed in line_ca */
+    size_t tokens_count;               /**< Tokens opened so far */
+    bool in_token_b;                   /**< Currently inside a token body */
+    bool discard_b;                    /**< Dropping bytes until the next terminator */
+} stream_state_st;
+
+static stream_state_st stream_state;
+
+/**
+ * @brief Resets the carry-over state to an empty line.
+ */
+static void stream_reset(void)
+{
+    stream_state.used = 0u;
+    stream_state.tokens_count = 0u;
+    stream_state.in_token_b = false;
+    stream_state.discard_b = false;
+}
+
+/**
+ * @brief Closes the token currently being assembled, if any.
+ *
+ * Writes the terminating '\0' the in-place tokenizer would have placed
+ * over the separator, and records the token's length — the dispatcher
+ * consumes pointer/length pairs and never re-scans the bytes. `used`
+ * always has room: token bytes are only appended while at least one
+ * spare byte remains.
+ */
+static void stream_close_token(void)
+{
+    if (stream_state.in_token_b)
+    {
+        ce_token_st *token_pst = &stream_state.tokens_ast[stream_state.tokens_count - 1u];
+
+        token_pst->len_u16 =
+            (uint16_t)(&stream_state.line_ca[stream_state.used] - token_pst->ptr_cp);
+        stream_state.line_ca[stream_state.used] = '\0';
+        stream_state.used++;
+        stream_state.in_token_b = false;
+    }
+}
+
+size_t ce_feed(const uint8_t *chunk_u8p, size_t len)
+{
+    size_t dispatched = 0u;
+
+    if (NULL == chunk_u8p)
+    {
+        LOG_ERR(CE_FILE_DISPATCH_e, "Null pointer");
+        return 0u;
+    }
+
+    for (size_t i = 0u; i < len; ++i)
+    {
+        char c = (char)chunk_u8p[i];
+
+        if (STREAM_IS_TERMINATOR(c))
+        {
+            bool drop_b = stream_state.discard_b;
+
+            stream_close_token();
+
+            if ((!drop_b) && (stream_state.tokens_count > 0u))
+            {
+                if (ce_dispatch_tokens(stream_state.tokens_ast, stream_state.tokens_count))
+                {
+                    dispatched++;
+                }
+            }
+
+            /* Empty and discarded lines resynchronize silently */
+            stream_reset();
+            continue;
+        }
+
+        if (stream_state.discard_b)
+        {
+            continue;
+        }
+
+        if (STREAM_IS_SEPARATOR(c))
+        {
+            stream_close_token();
+            continue;
+        }
+
+        if (!stream_state.in_token_b)
+        {
+            if (MAX_TOKENS == stream_state.tokens_count)
+            {
+                LOG_ERR(CE_FILE_DISPATCH_e,
+                        "Too many tokens, maximum allowed is %u, line dropped",
+                        (unsigned)MAX_TOKENS);
+                stream_state.discard_b = true;
+                continue;
+            }
+
+            stream_state.tokens_ast[stream_state.tokens_count].ptr_cp =
+                &stream_state.line_ca[stream_state.used];
+            stream_state.tokens_ast[stream_state.tokens_count].len_u16 = 0u;
+            stream_state.tokens_count++;
+            stream_state.in_token_b = true;
+        }
+
+        /* Keep one byte spare for the closing '\0' of the current token */
+        if (stream_state.used >= (MAX_LINE_BUF_SIZE - 1u))
+        {
+            LOG_ERR(CE_FILE_DISPATCH_e, "Input line truncated");
+            stream_state.discard_b = true;
+            continue;
+        }
+
+        stream_state.line_ca[stream_state.used] = c;
+        stream_state.used++;
+    }
+
+    return dispatched;
+}
+
+void ce_feed_reset(void)
+{
+    stream_reset();
+}
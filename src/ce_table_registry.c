@@ -0,0 +1,136 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_table_registry.c
+ * @brief Implements the fixed-capacity registry for module signature tables.
+ *
+ * Systems linking several firmware modules can register each module's
+ * generated table instead of merging all YAMLs into one monolith. Lookup
+ * is two-level: the primary generated table first, then each registered
+ * table, every one resolved with its own O(log n) binary search over its
+ * hash-sorted entries.
+ */
+
+#include <stddef.h>
+
+#include "logger.h"
+#include "ce_table.h"
+
+#ifndef CE_TABLE_REGISTRY_SIZE
+#define CE_TABLE_REGISTRY_SIZE (4u)  /**< Maximum number of registered module tables */
+#endif
+
+/**
+ * @brief One registered module table.
+ */
+typedef struct {
+    const ce_signature_st *table_ast;  /**< Hash-sorted signature array */
+    size_t count;                      /**< Number of entries in the array */
+} registry_slot_st;
+
+static registry_slot_st registry_slots[CE_TABLE_REGISTRY_SIZE];
+static size_t registry_count = 0u;
+
+/**
+ * @brief Lower-bound binary search over one hash-sorted table.
+ *
+ * @param table_ast Hash-sorted signature array.
+ * @param count     Number of entries.
+ * @param hash_u32  Hash to resolve.
+ * @return Matching entry, or NULL.
+ */
+static const ce_signature_st *table_search(const ce_signature_st *table_ast,
+                                           size_t count,
+                                           uint32_t hash_u32)
+{
+    size_t lo = 0u;
+    size_t hi = count;
+
+    while (lo < hi)
+    {
+        size_t mid = lo + ((hi - lo) / 2u);
+
+        if (table_ast[mid].hash_u32 < hash_u32)
+        {
+            lo = mid + 1u;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if ((lo < count) && (table_ast[lo].hash_u32 == hash_u32))
+    {
+        return &table_ast[lo];
+    }
+
+    return NULL;
+}
+
+bool ce_table_register(const ce_signature_st *table_ast, size_t count)
+{
+    if ((NULL == table_ast) || (0u == count))
+    {
+        LOG_ERR(CE_FILE_TABLE_e, "Invalid table registration");
+        return false;
+    }
+
+    if (registry_count >= CE_TABLE_REGISTRY_SIZE)
+    {
+        LOG_ERR(CE_FILE_TABLE_e, "Table registry full (%u slots)",
+                (unsigned)CE_TABLE_REGISTRY_SIZE);
+        return false;
+    }
+
+    /* The per-table binary search requires strictly ascending hashes */
+    for (size_t i = 1u; i < count; ++i)
+    {
+        if (table_ast[i - 1u].hash_u32 >= table_ast[i].hash_u32)
+        {
+            LOG_ERR(CE_FILE_TABLE_e, "Table not sorted by hash at entry %lu",
+                    (unsigned long)i);
+            return false;
+        }
+    }
+
+    registry_slots[registry_count].table_ast = table_ast;
+    registry_slots[registry_count].count = count;
+    registry_count++;
+
+    return true;
+}
+
+const ce_signature_st *ce_table_resolve_hash(uint32_t hash_u32)
+{
+    /* Primary generated table first: it serves the bulk of the traffic
+     * and takes precedence on duplicate hashes.
+     */
+    const ce_signature_st *sig_pst = ce_table_lookup_hash(hash_u32);
+
+    if (NULL != sig_pst)
+    {
+        return sig_pst;
+    }
+
+    for (size_t i = 0u; i < registry_count; ++i)
+    {
+        sig_pst = table_search(registry_slots[i].table_ast,
+                               registry_slots[i].count,
+                               hash_u32);
+        if (NULL != sig_pst)
+        {
+            return sig_pst;
+        }
+    }
+
+    return NULL;
+}
+
+#ifdef UNIT_TEST
+
+void _test_table_registry_reset(void)
+{
+    registry_count = 0u;
+}
+
+#endif /* UNIT_TEST */
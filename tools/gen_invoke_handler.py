@@ -4,7 +4,7 @@ Invoke handler generator from YAML command definitions.
 """
 
 from pathlib import Path
-from utils import TYPE_MAP
+from utils import is_vectored, TYPE_MAP
 
 
 class InvokeGenerator:
@@ -17,6 +17,16 @@ class InvokeGenerator:
 
     It relies on `ARGVAL(type, value)` to extract argument values
     and cast them to their correct types for the handler call.
+
+    Commands marked `long_running: true` get a resumable shim instead of
+    the direct call: their handler returns `ce_long_status_et`, and a
+    `CE_LONG_CONTINUE_e` first slice defers `<handler>_resume` (which the
+    YAML includes must declare) to the cooperative scheduler.
+
+    Commands whose trailing argument carries `repeat: true` are
+    "vectored": the shim gathers the repeated values into a typed local
+    array and passes pointer+count to the handler, so one line amortizes
+    the fixed dispatch cost over the whole batch.
     """
 
     def __init__(self, commands, includes):
@@ -58,9 +68,13 @@ class InvokeGenerator:
             "#include <stdio.h>",
             '#include "ce_types.h"',
             '#include "ce_command_ids.h"',
-            "",
         ]
 
+        if any(cmd.get("long_running", False) for cmd in self.commands):
+            lines.append('#include "ce_scheduler.h"')
+
+        lines.append("")
+
         # Add any additional includes from YAML
         for inc in self.includes:
             lines.append(f'#include "{inc}"')
@@ -68,8 +82,11 @@ class InvokeGenerator:
         lines += [
             "",
             "bool ce_invoke_handler(const ce_signature_st *sig_pst,",
-            "                       const ce_arg_value_ut args_a[MAX_TOKENS])",
+            "                       const ce_arg_value_ut args_a[MAX_TOKENS],",
+            "                       uint8_t arg_count_u8)",
             "{",
+            "    (void)arg_count_u8;  /* used by vectored commands only */",
+            "",
             "    switch ((ce_cmd_hash_et)sig_pst->hash_u32)",
             "    {",
         ]
@@ -77,34 +94,75 @@ class InvokeGenerator:
         for cmd in self.commands:
             name = cmd["name"]
             args = cmd.get("args", [])
+            long_running = cmd.get("long_running", False)
+            vectored = is_vectored(cmd)
 
             # Comment with the command name
             lines.append(f"        case CE_CMD_{name.upper()}_e:")
 
             # Determine C types from argument types
             cast_types = [TYPE_MAP[arg["type"]][1] for arg in args]
-
-            # Generate the casted function pointer
-            if not cast_types:
-                # No args
-                lines.append("            return ((bool (*)(void))sig_pst->handler)();")
+            prelude = []
+            if vectored:
+                # Gather the repeated trailing values into a typed local
+                # array handed to the handler as pointer+count.
+                vec_type = cast_types[-1]
+                fixed = len(args) - 1
+                cast_types[-1] = f"const {vec_type} *"
+                cast_types.append("uint8_t")
+                prelude = [
+                    f"            {vec_type} vec_a[MAX_TOKENS];",
+                    f"            uint8_t vec_count_u8 = (uint8_t)(arg_count_u8 - {fixed}u);",
+                    "",
+                    "            for (uint8_t i = 0u; i < vec_count_u8; ++i)",
+                    "            {",
+                    f"                vec_a[i] = ({vec_type})ARGVAL(sig_pst->types_e[{fixed}],"
+                    f" args_a[{fixed}u + i]);",
+                    "            }",
+                    "",
+                ]
+
+            ret_type = "ce_long_status_et" if long_running else "bool"
+            sig_cast = f"{ret_type} (*)({', '.join(cast_types) or 'void'})"
+
+            # Cast and extract each argument
+            arg_lines = []
+            for i, typ in enumerate(cast_types):
+                if vectored and i >= (len(args) - 1):
+                    break
+                val = f"ARGVAL(sig_pst->types_e[{i}], args_a[{i}])"
+                if typ in ["const char *", "const uint8_t *"]:
+                    arg_lines.append(f"                ({typ})(uintptr_t){val}")
+                else:
+                    arg_lines.append(f"                ({typ}){val}")
+
+            if vectored:
+                arg_lines += [
+                    "                vec_a",
+                    "                vec_count_u8",
+                ]
+
+            call_args = "" if not arg_lines else "\n" + ",\n".join(arg_lines) + "\n            "
+
+            if long_running:
+                # Resumable shim: run the first slice inline, defer the
+                # rest to the cooperative scheduler.
+                lines += ["        {"] + prelude + [
+                    f"            ce_long_status_et status_e = (({sig_cast})sig_pst->handler)({call_args});",
+                    "            if (CE_LONG_CONTINUE_e == status_e)",
+                    "            {",
+                    f"                return ce_scheduler_defer({cmd['handler']}_resume);",
+                    "            }",
+                    "            return (CE_LONG_DONE_e == status_e);",
+                    "        }",
+                ]
+            elif vectored:
+                lines += ["        {"] + prelude + [
+                    f"            return (({sig_cast})sig_pst->handler)({call_args});",
+                    "        }",
+                ]
             else:
-                # Signature: bool (*)(type1, type2, ...)
-                sig_cast = f"bool (*)({', '.join(cast_types)})"
-
-                lines.append(f"            return (({sig_cast})sig_pst->handler)(")
-
-                # Cast and extract each argument
-                arg_lines = []
-                for i, typ in enumerate(cast_types):
-                    val = f"ARGVAL(sig_pst->types_e[{i}], args_a[{i}])"
-                    if typ in ["const char *", "const uint8_t *"]:
-                        arg_lines.append(f"                ({typ})(uintptr_t){val}")
-                    else:
-                        arg_lines.append(f"                ({typ}){val}")
-
-                # Join all arguments
-                lines.append(",\n".join(arg_lines) + "\n            );")
+                lines.append(f"            return (({sig_cast})sig_pst->handler)({call_args});")
 
         # Default case for unknown commands
         lines += [
@@ -4,7 +4,7 @@ Source code generators from YAML command definitions.
 """
 
 from pathlib import Path
-from utils import djb2_hash, TYPE_MAP
+from utils import djb2_hash, is_vectored, TYPE_MAP
 
 
 class SignatureTableGenerator:
@@ -26,6 +26,10 @@ class SignatureTableGenerator:
         Returns:
             The complete C source code as a single string.
         """
+        # Emit the table sorted by ascending hash so the generated binary
+        # search in ce_table_lookup_hash() is valid by construction.
+        commands = sorted(self.commands, key=lambda cmd: djb2_hash(cmd["name"]))
+
         lines = [
             "/* SPDX-License-Identifier: Apache-2.0 */",
             "/**",
@@ -36,6 +40,13 @@ class SignatureTableGenerator:
             " * YAML configuration. It defines command hashes, their associated",
             " * handler functions, and argument type signatures.",
             " *",
+            " * The table is emitted sorted by ascending hash value, which allows",
+            " * `ce_table_lookup_hash()` to resolve a command in O(log n) with a",
+            " * lower-bound binary search instead of a linear scan. The search runs",
+            " * over a dense parallel `uint32_t` hash array (16 hashes per cache",
+            " * line) so the cold signature entries — handler pointers and type",
+            " * arrays — are only touched after the match.",
+            " *",
             " * It also provides accessor functions to retrieve the command signatures",
             " * at runtime.",
             " *",
@@ -46,6 +57,7 @@ class SignatureTableGenerator:
             "#include <stddef.h>",
             "#include <stdint.h>",
             "#include <stdbool.h>",
+            "#include <string.h>",
             '#include "ce_table.h"',
             '#include "ce_command_ids.h"',
             "",
@@ -59,33 +71,79 @@ class SignatureTableGenerator:
             "    _Static_assert(__builtin_types_compatible_p( \\",
             "        typeof(&(fn)), bool (*)(__VA_ARGS__)     \\",
             '    ), "Signature mismatch: " #fn)',
+            "/* long_running handlers return ce_long_status_et instead of bool */",
+            "#define CE_ASSERT_ARGS_LONG(fn, ...)                      \\",
+            "    _Static_assert(__builtin_types_compatible_p(          \\",
+            "        typeof(&(fn)), ce_long_status_et (*)(__VA_ARGS__) \\",
+            '    ), "Signature mismatch: " #fn)',
             "#else",
             '#warning "CE_ASSERT_ARGS: function signature checks not available on this compiler!"',
             "#define CE_ASSERT_ARGS(fn, ...)",
+            "#define CE_ASSERT_ARGS_LONG(fn, ...)",
             "#endif",
             "",
         ]
 
-        for cmd in self.commands:
+        for cmd in commands:
             types = [TYPE_MAP[arg["type"]][1] for arg in cmd.get("args", [])]
-            lines.append(f"CE_ASSERT_ARGS({cmd['handler']}, {', '.join(types) or 'void'});")
+            if is_vectored(cmd):
+                # The repeated trailing argument arrives as pointer+count
+                types[-1] = f"const {types[-1]} *"
+                types.append("uint8_t")
+            macro = "CE_ASSERT_ARGS_LONG" if cmd.get("long_running", False) else "CE_ASSERT_ARGS"
+            lines.append(f"{macro}({cmd['handler']}, {', '.join(types) or 'void'});")
 
         lines.append("")
+        lines.append("/* Fused parse-and-invoke entry points (defined in ce_exec.c).")
+        lines.append(" * Vectored commands have none: only the generic path carries the")
+        lines.append(" * runtime token count their handlers need.")
+        lines.append(" */")
+        for cmd in commands:
+            if not is_vectored(cmd):
+                lines.append(f"bool ce_exec_{cmd['name']}(char *tokens_apc[]);")
 
-        for cmd in self.commands:
+        lines.append("")
+
+        for cmd in commands:
             name = cmd["name"]
             enums = [TYPE_MAP[arg["type"]][0] for arg in cmd.get("args", [])]
             lines.append(f"static const ce_arg_type_et ce_args_{name}_ae[] = {{")
             lines.append(f"    {', '.join(enums)}") if enums else None
             lines.append("};\n")
 
+        # Name index sorted lexicographically (strcmp order) so the prefix
+        # lookup can binary-search it; note this order differs from the
+        # hash order of the signature table.
+        lines.append("/* Command names sorted lexicographically for prefix lookup */")
+        lines.append("static const char *const ce_command_names_apc[] = {")
+        for cmd in sorted(self.commands, key=lambda c: c["name"]):
+            lines.append(f'    "{cmd["name"]}",')
+        lines.append("};\n")
+
+        # Dense hash array in the same (hash-sorted) order as the signature
+        # table: the lookup search touches only this array, keeping the cold
+        # per-command data out of the cache until a match is found.
+        lines.append("/* Dense hash index scanned alone during lookup (SoA hot column) */")
+        lines.append("static const uint32_t ce_command_hashes_ua[] = {")
+        for cmd in commands:
+            lines.append(f"    0x{djb2_hash(cmd['name']):08X}u,  /* {cmd['name']} */")
+        lines.append("};\n")
+
         lines.append("static const ce_signature_st ce_signature_table_ast[] = {")
-        for cmd in self.commands:
+        for cmd in commands:
+            arg_count = len(cmd.get("args", []))
+            exec_ref = "NULL" if is_vectored(cmd) else f"ce_exec_{cmd['name']}"
             lines.append("    {")
             lines.append(f"        .hash_u32 = 0x{djb2_hash(cmd['name']):08X}u,")
             lines.append(f"        .handler = (handler_func_t){cmd['handler']},")
+            lines.append(f"        .exec_fn = {exec_ref},")
             lines.append(f"        .types_e = ce_args_{cmd['name']}_ae,")
-            lines.append(f"        .type_count_u8 = {len(cmd.get('args', []))}u")
+            if is_vectored(cmd):
+                lines.append(f"        .type_count_u8 = {arg_count}u,")
+                lines.append("        .repeat_min_u8 = 1u,")
+                lines.append(f"        .repeat_max_u8 = (uint8_t)(MAX_TOKENS - {arg_count}u)")
+            else:
+                lines.append(f"        .type_count_u8 = {arg_count}u")
             lines.append("    },")
         lines.append("};\n")
 
@@ -98,6 +156,94 @@ class SignatureTableGenerator:
             "{",
             "    return sizeof(ce_signature_table_ast) / sizeof(ce_signature_table_ast[0]);",
             "}\n",
+            "const char *const *ce_table_get_names(void)",
+            "{",
+            "    return ce_command_names_apc;",
+            "}\n",
+            "size_t ce_table_find_prefix(const char *prefix_cp, size_t *first_idx_p)",
+            "{",
+            "    size_t count = sizeof(ce_command_names_apc) / sizeof(ce_command_names_apc[0]);",
+            "    size_t prefix_len;",
+            "    size_t lo;",
+            "    size_t hi;",
+            "    size_t first;",
+            "",
+            "    if ((NULL == prefix_cp) || (NULL == first_idx_p))",
+            "    {",
+            "        return 0u;",
+            "    }",
+            "",
+            "    prefix_len = strlen(prefix_cp);",
+            "",
+            "    /* First binary search: lowest name not lexicographically below",
+            "     * the prefix.",
+            "     */",
+            "    lo = 0u;",
+            "    hi = count;",
+            "    while (lo < hi)",
+            "    {",
+            "        size_t mid = lo + ((hi - lo) / 2u);",
+            "",
+            "        if (strncmp(ce_command_names_apc[mid], prefix_cp, prefix_len) < 0)",
+            "        {",
+            "            lo = mid + 1u;",
+            "        }",
+            "        else",
+            "        {",
+            "            hi = mid;",
+            "        }",
+            "    }",
+            "    first = lo;",
+            "",
+            "    /* Second binary search: first name past the prefix range */",
+            "    hi = count;",
+            "    while (lo < hi)",
+            "    {",
+            "        size_t mid = lo + ((hi - lo) / 2u);",
+            "",
+            "        if (strncmp(ce_command_names_apc[mid], prefix_cp, prefix_len) <= 0)",
+            "        {",
+            "            lo = mid + 1u;",
+            "        }",
+            "        else",
+            "        {",
+            "            hi = mid;",
+            "        }",
+            "    }",
+            "",
+            "    *first_idx_p = first;",
+            "    return lo - first;",
+            "}\n",
+            "const ce_signature_st* ce_table_lookup_hash(uint32_t hash_u32)",
+            "{",
+            "    size_t lo = 0u;",
+            "    size_t hi = sizeof(ce_command_hashes_ua) / sizeof(ce_command_hashes_ua[0]);",
+            "",
+            "    /* Lower-bound search over the dense hash array only; the cold",
+            "     * signature entry is indexed once at the match position.",
+            "     */",
+            "    while (lo < hi)",
+            "    {",
+            "        size_t mid = lo + ((hi - lo) / 2u);",
+            "",
+            "        if (ce_command_hashes_ua[mid] < hash_u32)",
+            "        {",
+            "            lo = mid + 1u;",
+            "        }",
+            "        else",
+            "        {",
+            "            hi = mid;",
+            "        }",
+            "    }",
+            "",
+            "    if ((lo < (sizeof(ce_command_hashes_ua) / sizeof(ce_command_hashes_ua[0]))) &&",
+            "        (ce_command_hashes_ua[lo] == hash_u32))",
+            "    {",
+            "        return &ce_signature_table_ast[lo];",
+            "    }",
+            "",
+            "    return NULL;",
+            "}\n",
         ]
         return "\n".join(lines)
 
@@ -12,14 +12,22 @@ Generated outputs include:
   - `ce_command_ids.h`     : Command hash defines (used in host/MCU)
   - `ce_table.c`           : Signature table linking hashes to handlers
   - `ce_invoke_handler.c`  : Generic runtime dispatcher
+  - `ce_exec.c`            : Fused per-command parse-and-invoke functions
+  - `ce_frame_layout.h`    : Binary frame layout constants (host/MCU)
+  - `ce_config.h`          : Engine buffer limits (from YAML 'limits:')
 
 Usage:
-    python tools/generate_apis.py input.yaml [--header out.h] [--sigtable out.c] [--invoke out.c] [options]
+    python tools/generate_apis.py --input input.yaml [--input extra.yaml ...] [--header out.h] [--sigtable out.c] [--invoke out.c] [options]
 
 Options:
+    --input         Input YAML definition file; repeatable, files are merged
+                    in order and validated as one command set
     --header        Output header file for command hashes (default: ce_command_ids.h)
     --sigtable      Output C source file for dispatch table (default: ce_table.c)
     --invoke        Output C source file for invoke handler (default: apis/ce_invoke_handler.c)
+    --exec          Output C source file for fused exec functions (default: ce_exec.c)
+    --frame         Output header file for binary frame layout (default: ce_frame_layout.h)
+    --config        Output header file for engine limits (default: ce_config.h)
     --check-only    Validate YAML structure only, no code is generated
     --dry-run       Print generated code to stdout without writing to files
     --verbose       Print detailed info during parsing and code generation
@@ -9,6 +9,9 @@ from parser import CommandParser
 from gen_header import HeaderGenerator
 from gen_signature_table import SignatureTableGenerator
 from gen_invoke_handler import InvokeGenerator
+from gen_exec import ExecGenerator
+from gen_frame_layout import FrameLayoutGenerator
+from gen_config import ConfigGenerator
 from cli import CliArgs
 
 
@@ -22,17 +25,21 @@ def main():
         if not args.input:
             raise ValueError("Missing required argument: --input")
 
-        parser = CommandParser(Path(args.input))
+        parser = CommandParser([Path(f) for f in args.input])
         parser.load()
 
         if args.check_only:
-            print(f"✅ YAML '{args.input}' is valid with {len(parser.commands)} command(s).")
+            inputs = ", ".join(f"'{f}'" for f in args.input)
+            print(f"✅ YAML {inputs} is valid with {len(parser.commands)} command(s).")
             sys.exit(0)
 
         # === Code Generators ===
         header_gen = HeaderGenerator(parser.commands)
         table_gen = SignatureTableGenerator(parser.commands, parser.includes)
         invoke_gen = InvokeGenerator(parser.commands, parser.includes)
+        exec_gen = ExecGenerator(parser.commands, parser.includes)
+        frame_gen = FrameLayoutGenerator(parser.commands)
+        config_gen = ConfigGenerator(parser.commands, parser.limits)
 
         if args.dry_run:
             print("\n// ==== HEADER FILE ====\n")
@@ -43,16 +50,31 @@ def main():
 
             print("\n// ==== INVOKE HANDLER ====\n")
             print(invoke_gen.render(args.invoke))
+
+            print("\n// ==== FUSED EXEC ====\n")
+            print(exec_gen.render(args.exec_out))
+
+            print("\n// ==== FRAME LAYOUT ====\n")
+            print(frame_gen.render(args.frame))
+
+            print("\n// ==== ENGINE LIMITS ====\n")
+            print(config_gen.render(args.config))
         else:
             header_gen.write_to(Path(args.header))
             table_gen.write_to(Path(args.sigtable))
             invoke_gen.write_to(Path(args.invoke))
+            exec_gen.write_to(Path(args.exec_out))
+            frame_gen.write_to(Path(args.frame))
+            config_gen.write_to(Path(args.config))
 
             if args.verbose:
                 print("✅ Generated:")
                 print(f"  - {args.header}")
                 print(f"  - {args.sigtable}")
                 print(f"  - {args.invoke}")
+                print(f"  - {args.exec_out}")
+                print(f"  - {args.frame}")
+                print(f"  - {args.config}")
                 print("📦 Commands:")
                 for cmd in parser.commands:
                     print(f"  - {cmd['name']}")
@@ -10,43 +10,81 @@ from utils import djb2_hash, TYPE_MAP
 
 class CommandParser:
     """
-    Load and validate the YAML input defining commands and includes.
+    Load and validate the YAML input(s) defining commands and includes.
     Ensures structural correctness and checks for invalid or duplicate hash usage.
+
+    Multiple input files are merged in order into one command set; all
+    cross-command checks (duplicate names, DJB2 hash collisions) run on the
+    merged set, so a collision between commands from different files fails
+    generation just like one within a single file. That guarantee is what
+    lets the engine match on hash alone with no runtime name verification
+    (see CE_TABLE_COLLISION_FREE in the generated header).
     """
 
-    ALLOWED_KEYS = {"commands", "includes"}
+    ALLOWED_KEYS = {"commands", "includes", "limits"}
+    ALLOWED_LIMIT_KEYS = {"max_tokens", "max_arg_content_size", "max_line_buf_size"}
 
-    def __init__(self, input_file: Path):
+    def __init__(self, input_files):
         self.yaml = YAML()
         self.yaml.preserve_quotes = True
         self.yaml.indent(mapping=2, sequence=4, offset=2)
-        self.input_file = input_file
+        if isinstance(input_files, (str, Path)):
+            input_files = [input_files]
+        self.input_files = [Path(f) for f in input_files]
         self.commands = []
         self.includes = []
+        self.limits = {}
 
     def load(self):
-        """Load and parse the YAML file, then validate its structure."""
-        if not self.input_file.exists():
-            raise FileNotFoundError(f"YAML input file not found: {self.input_file}")
-        data = self.yaml.load(self.input_file)
+        """Load and merge all YAML files, then validate the merged structure."""
+        if not self.input_files:
+            raise ValueError("No YAML input files given")
+
+        for input_file in self.input_files:
+            self._load_one(input_file)
+
+        self._validate()
+        self._validate_limits()
+
+    def _load_one(self, input_file: Path):
+        """Load one YAML file and merge its sections into the parser state."""
+        if not input_file.exists():
+            raise FileNotFoundError(f"YAML input file not found: {input_file}")
+        data = self.yaml.load(input_file)
 
         if data is None:
-            raise ValueError(f"YAML input file '{self.input_file}' is empty or invalid")
+            raise ValueError(f"YAML input file '{input_file}' is empty or invalid")
 
         # Ensure only known top-level keys are present
         extra = set(data.keys()) - self.ALLOWED_KEYS
         if extra:
             raise ValueError(f"Unsupported YAML section(s): {', '.join(extra)}")
 
-        self.commands = data.get("commands", [])
-        self.includes = data.get("includes", [])
+        commands = data.get("commands", [])
+        includes = data.get("includes", [])
+        limits = data.get("limits", {}) or {}
 
-        if not isinstance(self.commands, list):
+        if not isinstance(commands, list):
             raise ValueError("'commands' must be a list")
-        if not isinstance(self.includes, list):
+        if not isinstance(includes, list):
             raise ValueError("'includes' must be a list")
-
-        self._validate()
+        if not isinstance(limits, dict):
+            raise ValueError("'limits' must be a mapping")
+
+        self.commands.extend(commands)
+        for include in includes:
+            if include not in self.includes:
+                self.includes.append(include)
+
+        # Explicit limits must agree across files: a silent "last one wins"
+        # could shrink buffers another file's commands were sized for.
+        for key, value in limits.items():
+            if key in self.limits and self.limits[key] != value:
+                raise ValueError(
+                    f"❌ Conflicting limit '{key}' across YAML inputs: "
+                    f"{self.limits[key]} vs {value} (in '{input_file}')"
+                )
+            self.limits[key] = value
 
     def _validate(self):
         """Validate command structure, types, name formats, and detect hash collisions."""
@@ -79,11 +117,15 @@ class CommandParser:
                 )
             seen_hashes[hash_val] = name
 
+            long_running = cmd.get("long_running", False)
+            if not isinstance(long_running, bool):
+                raise ValueError(f"❌ 'long_running' for command '{name}' must be a boolean")
+
             args = cmd.get("args", [])
             if not isinstance(args, list):
                 raise ValueError(f"'args' for command '{name}' must be a list")
 
-            for arg in args:
+            for j, arg in enumerate(args):
                 if not isinstance(arg, dict):
                     raise ValueError(f"❌ Each argument of command '{name}' must be a dict")
                 if "type" not in arg:
@@ -91,6 +133,40 @@ class CommandParser:
                 if arg["type"] not in TYPE_MAP:
                     raise ValueError(f"❌ Unsupported type '{arg['type']}' in command '{name}'")
 
+                repeat = arg.get("repeat", False)
+                if not isinstance(repeat, bool):
+                    raise ValueError(f"❌ 'repeat' in command '{name}' must be a boolean")
+                if repeat:
+                    if j != (len(args) - 1):
+                        raise ValueError(
+                            f"❌ 'repeat' in command '{name}' is only allowed on the trailing argument"
+                        )
+                    if TYPE_MAP[arg["type"]][0] in ("TYPE_STRING_e", "TYPE_UINT8_PTR_e"):
+                        raise ValueError(
+                            f"❌ 'repeat' in command '{name}' requires a scalar argument type"
+                        )
+
+    def _validate_limits(self):
+        """Validate the optional 'limits' section against the command set."""
+        extra = set(self.limits.keys()) - self.ALLOWED_LIMIT_KEYS
+        if extra:
+            raise ValueError(f"Unsupported limit key(s): {', '.join(sorted(extra))}")
+
+        for key, value in self.limits.items():
+            if not isinstance(value, int) or isinstance(value, bool) or value <= 0:
+                raise ValueError(f"❌ Limit '{key}' must be a positive integer")
+
+        # An explicit max_tokens must still fit the widest declared command
+        # (command name + its arguments).
+        required_tokens = max(
+            (len(cmd.get("args", [])) + 1 for cmd in self.commands), default=1
+        )
+        if self.limits.get("max_tokens", required_tokens) < required_tokens:
+            raise ValueError(
+                f"❌ max_tokens {self.limits['max_tokens']} is below the "
+                f"{required_tokens} tokens needed by the widest command"
+            )
+
     @staticmethod
     def _is_valid_c_identifier(identifier: str) -> bool:
         """Return True if the given name is a valid C identifier."""
@@ -0,0 +1,258 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file ce_replay.c
+ * @brief Replays a recorded command capture against the engine.
+ *
+ * Memory-maps a newline-delimited capture of production command traffic,
+ * pumps every line through `ce_dispatch_from_line()`, and reports
+ * throughput (commands/sec), p50/p99/max per-dispatch latency, and
+ * failure counts. Use it to validate perf changes against real traffic
+ * shapes instead of synthetic micro-benchmarks:
+ *
+ *     ce_replay capture.txt [repeat-count]
+ *
+ * The bundled demo handlers are stubs; link the tool against your own
+ * handler implementations to replay captures of a real command set.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ce_types.h"
+#include "ce_dispatch.h"
+#include "demo.h"
+
+/* Demo handler stubs (the generated table references them) */
+bool demo_cat_string(const char *s) { (void)s; return true; }
+bool demo_cat_byte(uint8_t b) { (void)b; return true; }
+bool demo_cat_bytes(const uint8_t *data, uint8_t len) { (void)data; (void)len; return true; }
+bool demo_void(void) { return true; }
+bool demo_cat_mixed(const uint8_t *u8a1, const uint8_t *u8a2, const char *s1,
+                    const char *s2, const uint8_t *u8a3, int64_t i64, uint32_t u32)
+{
+    (void)u8a1; (void)u8a2; (void)s1; (void)s2; (void)u8a3; (void)i64; (void)u32;
+    return true;
+}
+bool demo_cal_set(uint8_t idx, const uint16_t *vals, uint8_t count)
+{
+    (void)idx; (void)vals; (void)count;
+    return true;
+}
+ce_long_status_et demo_slow_work(uint8_t slices) { (void)slices; return CE_LONG_DONE_e; }
+ce_long_status_et demo_slow_work_resume(void) { return CE_LONG_DONE_e; }
+
+/**
+ * @brief Monotonic timestamp in nanoseconds.
+ */
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ull) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Ascending comparator for latency samples.
+ */
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t lhs = *(const uint64_t *)a;
+    uint64_t rhs = *(const uint64_t *)b;
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+/**
+ * @brief Returns the given percentile from sorted latency samples.
+ */
+static uint64_t percentile(const uint64_t *sorted, size_t count, unsigned pct)
+{
+    size_t idx = (count * pct) / 100u;
+
+    if (idx >= count)
+    {
+        idx = count - 1u;
+    }
+
+    return sorted[idx];
+}
+
+/**
+ * @brief Checks whether a line contains only whitespace.
+ */
+static bool line_is_blank(const char *line, size_t len)
+{
+    for (size_t i = 0u; i < len; ++i)
+    {
+        if ((line[i] != ' ') && (line[i] != '\t') && (line[i] != '\r'))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if ((argc < 2) || (argc > 3))
+    {
+        fprintf(stderr, "usage: %s <capture-file> [repeat-count]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    unsigned long repeats = (argc == 3) ? strtoul(argv[2], NULL, 10) : 1ul;
+
+    if (0ul == repeats)
+    {
+        fprintf(stderr, "error: repeat-count must be >= 1\n");
+        return EXIT_FAILURE;
+    }
+
+    int fd = open(argv[1], O_RDONLY);
+
+    if (fd < 0)
+    {
+        perror("open");
+        return EXIT_FAILURE;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+    {
+        perror("fstat");
+        close(fd);
+        return EXIT_FAILURE;
+    }
+
+    if (0 == st.st_size)
+    {
+        fprintf(stderr, "error: capture file is empty\n");
+        close(fd);
+        return EXIT_FAILURE;
+    }
+
+    const char *capture = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (MAP_FAILED == capture)
+    {
+        perror("mmap");
+        close(fd);
+        return EXIT_FAILURE;
+    }
+
+    /* Upper bound on samples: one per newline plus a final unterminated line */
+    size_t max_lines = 1u;
+
+    for (size_t i = 0u; i < (size_t)st.st_size; ++i)
+    {
+        if ('\n' == capture[i])
+        {
+            max_lines++;
+        }
+    }
+
+    uint64_t *latencies = malloc(max_lines * repeats * sizeof(*latencies));
+
+    if (NULL == latencies)
+    {
+        fprintf(stderr, "error: out of memory for %lu samples\n",
+                (unsigned long)(max_lines * repeats));
+        munmap((void *)capture, (size_t)st.st_size);
+        close(fd);
+        return EXIT_FAILURE;
+    }
+
+    size_t dispatched = 0u;
+    size_t failed = 0u;
+    size_t samples = 0u;
+    uint64_t run_start = now_ns();
+
+    for (unsigned long rep = 0ul; rep < repeats; ++rep)
+    {
+        const char *cursor = capture;
+        const char *end = capture + st.st_size;
+
+        while (cursor < end)
+        {
+            const char *newline = memchr(cursor, '\n', (size_t)(end - cursor));
+            size_t line_len = (NULL != newline) ? (size_t)(newline - cursor)
+                                                : (size_t)(end - cursor);
+
+            if ((0u < line_len) && !line_is_blank(cursor, line_len))
+            {
+                char line_buf[MAX_LINE_BUF_SIZE];
+
+                if (line_len < sizeof(line_buf))
+                {
+                    memcpy(line_buf, cursor, line_len);
+                    line_buf[line_len] = '\0';
+
+                    uint64_t t0 = now_ns();
+                    bool ok = ce_dispatch_from_line(line_buf);
+
+                    latencies[samples] = now_ns() - t0;
+                    samples++;
+
+                    if (ok)
+                    {
+                        dispatched++;
+                    }
+                    else
+                    {
+                        failed++;
+                    }
+                }
+                else
+                {
+                    failed++;
+                }
+            }
+
+            cursor = (NULL != newline) ? (newline + 1) : end;
+        }
+    }
+
+    uint64_t elapsed_ns = now_ns() - run_start;
+
+    munmap((void *)capture, (size_t)st.st_size);
+    close(fd);
+
+    if (0u == samples)
+    {
+        fprintf(stderr, "error: no command lines found in capture\n");
+        free(latencies);
+        return EXIT_FAILURE;
+    }
+
+    qsort(latencies, samples, sizeof(*latencies), compare_u64);
+
+    double elapsed_s = (double)elapsed_ns / 1e9;
+    double cmds_per_sec = (double)samples / elapsed_s;
+
+    printf("capture:       %s (x%lu)\n", argv[1], repeats);
+    printf("commands:      %lu (%lu ok, %lu failed)\n",
+           (unsigned long)samples, (unsigned long)dispatched, (unsigned long)failed);
+    printf("elapsed:       %.3f s\n", elapsed_s);
+    printf("throughput:    %.0f cmds/sec\n", cmds_per_sec);
+    printf("latency p50:   %lu ns\n", (unsigned long)percentile(latencies, samples, 50u));
+    printf("latency p99:   %lu ns\n", (unsigned long)percentile(latencies, samples, 99u));
+    printf("latency max:   %lu ns\n", (unsigned long)latencies[samples - 1u]);
+
+    free(latencies);
+
+    return (0u == failed) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
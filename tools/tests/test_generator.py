@@ -12,6 +12,9 @@ sys.path.insert(0, os.path.abspath(os.path.join(os.path.dirname(__file__), "..")
 from gen_header import HeaderGenerator
 from gen_signature_table import SignatureTableGenerator
 from gen_invoke_handler import InvokeGenerator
+from gen_exec import ExecGenerator
+from gen_frame_layout import FrameLayoutGenerator
+from gen_config import ConfigGenerator
 from utils import djb2_hash
 
 
@@ -37,6 +40,33 @@ def test_header_macro_output():
     assert "core_api.h" in content
 
 
+def test_header_hash_constants():
+    """
+    Each command must get a CE_HASH_<NAME> preprocessor constant, and the
+    header must carry the DJB2 drift probe static assert.
+    """
+    gen = HeaderGenerator(sample_cmds)
+    content = gen.render("core_api.h")
+
+    for cmd in sample_cmds:
+        assert f"#define CE_HASH_{cmd['name'].upper()}" in content
+        assert f"0x{djb2_hash(cmd['name']):08X}u" in content
+
+    assert "_Static_assert" in content
+    assert "CE_DJB2_STEP" in content
+
+
+def test_header_collision_free_marker():
+    """
+    The header must carry the CE_TABLE_COLLISION_FREE marker: the parser
+    rejects any hash collision before generation, so the engine can rely
+    on it for hash-only matching with no runtime name verification.
+    """
+    gen = HeaderGenerator(sample_cmds)
+    content = gen.render("core_api.h")
+    assert "#define CE_TABLE_COLLISION_FREE (1u)" in content
+
+
 def test_signature_table_output():
     """
     Verify that the signature table renders correctly.
@@ -46,6 +76,63 @@ def test_signature_table_output():
     assert "ping_handler" in src
     assert "ce_args_ping_ae" in src
     assert "CE_ASSERT_ARGS" in src
+    assert "ce_table_lookup_hash" in src
+
+
+def test_signature_table_sorted_by_hash():
+    """
+    The emitted table must be sorted by ascending hash so the generated
+    binary search in ce_table_lookup_hash() is valid.
+    """
+    gen = SignatureTableGenerator(sample_cmds, [])
+    src = gen.render("ce_table.c")
+
+    import re
+
+    hashes = [int(h, 16) for h in re.findall(r"\.hash_u32 = 0x([0-9A-F]{8})u", src)]
+    assert len(hashes) == len(sample_cmds)
+    assert hashes == sorted(hashes)
+
+
+def test_signature_table_name_index():
+    """
+    The name index must be sorted lexicographically (independent of hash
+    order) and the prefix lookup must be emitted alongside it.
+    """
+    gen = SignatureTableGenerator(sample_cmds, [])
+    src = gen.render("ce_table.c")
+
+    import re
+
+    start = src.index("ce_command_names_apc[] = {")
+    end = src.index("};", start)
+    names = re.findall(r'"(\w+)"', src[start:end])
+
+    assert names == sorted(cmd["name"] for cmd in sample_cmds)
+    assert "ce_table_find_prefix" in src
+    assert "ce_table_get_names" in src
+
+
+def test_signature_table_soa_hash_index():
+    """
+    The dense hash array must mirror the signature table order exactly and
+    the lookup must binary-search it instead of the cold AoS entries.
+    """
+    gen = SignatureTableGenerator(sample_cmds, [])
+    src = gen.render("ce_table.c")
+
+    import re
+
+    start = src.index("ce_command_hashes_ua[] = {")
+    end = src.index("};", start)
+    dense = [int(h, 16) for h in re.findall(r"0x([0-9A-F]{8})u", src[start:end])]
+    aos = [int(h, 16) for h in re.findall(r"\.hash_u32 = 0x([0-9A-F]{8})u", src)]
+
+    assert dense == aos == sorted(aos)
+
+    lookup = src[src.index("ce_table_lookup_hash(uint32_t"):]
+    assert "ce_command_hashes_ua[mid]" in lookup
+    assert "ce_signature_table_ast[mid].hash_u32" not in lookup
 
 
 def test_invoke_handler_output():
@@ -60,6 +147,85 @@ def test_invoke_handler_output():
     assert "uint8_t" in code  # casted argument type
 
 
+def test_exec_output():
+    """
+    Each command must get a fused ce_exec_<name>() with the exact parse
+    calls for its signature and a direct handler call — no type switch.
+    """
+    gen = ExecGenerator(sample_cmds, [])
+    code = gen.render("ce_exec.c")
+
+    for cmd in sample_cmds:
+        assert f"bool ce_exec_{cmd['name']}(char *tokens_apc[])" in code
+
+    assert "return reset_handler();" in code                  # no-arg direct call
+    assert "parse_u8(tokens_apc[1], &arg0)" in code           # ping: single u8
+    assert "parse_hex_string(tokens_apc[1]" in code           # transmit: blob
+    assert "return tx_handler(arg0, arg1);" in code
+    assert "arg0 = tokens_apc[1];" in code                    # echo: zero-copy string
+
+    # Straight-line only: no type switch, no marshalling array anywhere in
+    # the code body (the file doc comment may mention them by name).
+    body = code[code.index("#include"):]
+    assert "ce_arg_value_ut" not in body
+    assert "switch" not in body
+
+
+def test_signature_table_references_exec():
+    """
+    The signature table must wire each entry's exec_fn to the generated
+    fused function so dispatch can go hash -> pointer -> straight-line.
+    """
+    gen = SignatureTableGenerator(sample_cmds, [])
+    src = gen.render("ce_table.c")
+
+    for cmd in sample_cmds:
+        assert f"bool ce_exec_{cmd['name']}(char *tokens_apc[]);" in src
+        assert f".exec_fn = ce_exec_{cmd['name']}," in src
+
+
+def test_frame_layout_output():
+    """
+    Check frame layout constants: hash, arg count, and minimum frame size
+    (4-byte hash + fixed widths + one length byte per variable-length arg).
+    """
+    gen = FrameLayoutGenerator(sample_cmds)
+    content = gen.render("ce_frame_layout.h")
+
+    assert "#define CE_FRAME_HASH_SIZE (4u)" in content
+    assert f"#define CE_FRAME_RESET_HASH     (0x{djb2_hash('reset'):08X}u)" in content
+    assert "#define CE_FRAME_RESET_MIN_SIZE (4u)" in content
+    assert "#define CE_FRAME_PING_MIN_SIZE (5u)" in content       # hash + u8
+    assert "#define CE_FRAME_TRANSMIT_MIN_SIZE (6u)" in content   # hash + len byte + u8
+    assert "#define CE_FRAME_ECHO_ARGC     (1u)" in content
+
+
+def test_config_computed_tokens():
+    """
+    Without explicit limits, MAX_TOKENS is derived from the widest command
+    (transmit: name + 2 args = 3) and the byte limits keep their defaults.
+    """
+    gen = ConfigGenerator(sample_cmds)
+    content = gen.render("ce_config.h")
+
+    assert "#define MAX_TOKENS (3U)" in content
+    assert "#define MAX_ARG_CONTENT_SIZE (64U)" in content
+    assert "#define MAX_LINE_BUF_SIZE (256U)" in content
+
+
+def test_config_explicit_limits_win():
+    """
+    Explicit YAML limits override both the computed and default values.
+    """
+    limits = {"max_tokens": 6, "max_arg_content_size": 128, "max_line_buf_size": 512}
+    gen = ConfigGenerator(sample_cmds, limits)
+    content = gen.render("ce_config.h")
+
+    assert "#define MAX_TOKENS (6U)" in content
+    assert "#define MAX_ARG_CONTENT_SIZE (128U)" in content
+    assert "#define MAX_LINE_BUF_SIZE (512U)" in content
+
+
 @pytest.mark.parametrize(
     "cmds",
     [
@@ -133,3 +299,107 @@ def test_enum_hash_values():
         value_str = f"= 0x{value:08X}u"
         assert enum_line in content
         assert value_str in content
+
+
+long_cmds = sample_cmds + [
+    {
+        "name": "erase",
+        "handler": "erase_handler",
+        "long_running": True,
+        "args": [{"type": "uint8"}],
+    },
+]
+
+
+def test_invoke_handler_long_running_shim():
+    """
+    A long_running command gets the defer-on-CONTINUE shim calling
+    <handler>_resume; short commands keep the direct call and the
+    scheduler header is only pulled in when needed.
+    """
+    code = InvokeGenerator(long_cmds, []).render("ce_invoke_handler.c")
+    assert '#include "ce_scheduler.h"' in code
+    assert "ce_long_status_et (*)(uint8_t)" in code
+    assert "ce_scheduler_defer(erase_handler_resume)" in code
+    assert "return (CE_LONG_DONE_e == status_e);" in code
+
+    # Short-command-only inputs must not reference the scheduler at all.
+    short_code = InvokeGenerator(sample_cmds, []).render("ce_invoke_handler.c")
+    assert "ce_scheduler" not in short_code
+
+
+def test_exec_long_running_shim():
+    """
+    The fused exec path mirrors the invoke shim: first slice inline,
+    CONTINUE defers the resume function, DONE maps to true.
+    """
+    code = ExecGenerator(long_cmds, []).render("ce_exec.c")
+    assert '#include "ce_scheduler.h"' in code
+    assert "ce_long_status_et status_e = erase_handler(arg0);" in code
+    assert "ce_scheduler_defer(erase_handler_resume)" in code
+    assert "return tx_handler(arg0, arg1);" in code  # short path unchanged
+
+    short_code = ExecGenerator(sample_cmds, []).render("ce_exec.c")
+    assert "ce_scheduler" not in short_code
+
+
+def test_signature_table_long_running_assert():
+    """
+    long_running handlers are signature-checked against ce_long_status_et
+    instead of bool.
+    """
+    src = SignatureTableGenerator(long_cmds, []).render("ce_table.c")
+    assert "CE_ASSERT_ARGS_LONG(erase_handler, uint8_t);" in src
+    assert "CE_ASSERT_ARGS(ping_handler, uint8_t);" in src
+
+
+vector_cmds = sample_cmds + [
+    {
+        "name": "cal_set",
+        "handler": "cal_set_handler",
+        "args": [{"type": "uint8"}, {"type": "uint16", "repeat": True}],
+    },
+]
+
+
+def test_signature_table_vectored_encoding():
+    """
+    Vectored commands carry the repetition range in the signature, take no
+    fused exec entry, and are signature-checked against pointer+count.
+    """
+    src = SignatureTableGenerator(vector_cmds, []).render("ce_table.c")
+    assert ".repeat_min_u8 = 1u," in src
+    assert ".repeat_max_u8 = (uint8_t)(MAX_TOKENS - 2u)" in src
+    assert "CE_ASSERT_ARGS(cal_set_handler, uint8_t, const uint16_t *, uint8_t);" in src
+    assert "bool ce_exec_cal_set" not in src
+
+    # The NULL exec_fn belongs to the vectored entry, not the fixed ones.
+    entry = src[src.index(".hash_u32 = 0x%08Xu" % djb2_hash("cal_set")) :]
+    assert ".exec_fn = NULL," in entry[: entry.index("},")]
+
+
+def test_invoke_handler_vectored_gather():
+    """
+    The invoke shim for a vectored command gathers the repeated values
+    into a typed array and calls the handler with pointer+count.
+    """
+    code = InvokeGenerator(vector_cmds, []).render("ce_invoke_handler.c")
+    assert "uint8_t arg_count_u8)" in code
+    assert "uint16_t vec_a[MAX_TOKENS];" in code
+    assert "vec_count_u8 = (uint8_t)(arg_count_u8 - 1u);" in code
+    assert "bool (*)(uint8_t, const uint16_t *, uint8_t)" in code
+
+
+def test_exec_skips_vectored_commands():
+    """Vectored commands must not get a fused exec function."""
+    code = ExecGenerator(vector_cmds, []).render("ce_exec.c")
+    assert "ce_exec_cal_set" not in code
+    assert "ce_exec_ping" in code
+
+
+def test_frame_layout_skips_vectored_commands():
+    """Vectored commands have no fixed wire layout."""
+    content = FrameLayoutGenerator(vector_cmds).render("ce_frame_layout.h")
+    assert "CE_FRAME_CAL_SET_MIN_SIZE" not in content
+    assert "cal_set: vectored command, no frame layout" in content
+    assert "CE_FRAME_PING_MIN_SIZE" in content
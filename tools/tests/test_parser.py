@@ -11,9 +11,9 @@ from parser import CommandParser
 # --------------------------------------------------------------------
 # Shared Helper
 # --------------------------------------------------------------------
-def write_yaml(tmp_path, content: str) -> Path:
+def write_yaml(tmp_path, content: str, name: str = "test.yaml") -> Path:
     """Write YAML content to a temp file and return the path."""
-    path = tmp_path / "test.yaml"
+    path = tmp_path / name
     path.write_text(content)
     return path
 
@@ -129,6 +129,206 @@ def test_parser_duplicate_names(tmp_path):
         parser.load()
 
 
+def test_parser_hash_collision(tmp_path):
+    """Two names with the same DJB2 hash must fail, naming both commands."""
+    # 'aab' and 'abA' are a genuine DJB2 collision (both 0x0B885C69).
+    yaml = """
+    commands:
+      - name: aab
+        handler: h1
+      - name: abA
+        handler: h2
+    """
+    file = write_yaml(tmp_path, yaml)
+    parser = CommandParser(file)
+    with pytest.raises(ValueError, match=r"Hash collision: 'abA' and 'aab'"):
+        parser.load()
+
+
+# --------------------------------------------------------------------
+# Merged Inputs
+# --------------------------------------------------------------------
+def test_parser_multi_input_merge(tmp_path):
+    """Commands from several files merge in input order."""
+    base = write_yaml(
+        tmp_path,
+        """
+        includes:
+          - base.h
+        commands:
+          - name: ping
+            handler: ping_func
+        """,
+        name="base.yaml",
+    )
+    extra = write_yaml(
+        tmp_path,
+        """
+        includes:
+          - base.h
+          - extra.h
+        commands:
+          - name: reset
+            handler: reset_func
+        """,
+        name="extra.yaml",
+    )
+    parser = CommandParser([base, extra])
+    parser.load()
+    assert [cmd["name"] for cmd in parser.commands] == ["ping", "reset"]
+    assert parser.includes == ["base.h", "extra.h"]
+
+
+def test_parser_duplicate_names_across_inputs(tmp_path):
+    """A command name reused in a later file must fail like an in-file duplicate."""
+    base = write_yaml(
+        tmp_path,
+        """
+        commands:
+          - name: ping
+            handler: h1
+        """,
+        name="base.yaml",
+    )
+    extra = write_yaml(
+        tmp_path,
+        """
+        commands:
+          - name: ping
+            handler: h2
+        """,
+        name="extra.yaml",
+    )
+    parser = CommandParser([base, extra])
+    with pytest.raises(ValueError, match=r"Duplicate command name: 'ping'"):
+        parser.load()
+
+
+def test_parser_hash_collision_across_inputs(tmp_path):
+    """A DJB2 collision between files must fail generation with both names."""
+    base = write_yaml(
+        tmp_path,
+        """
+        commands:
+          - name: aab
+            handler: h1
+        """,
+        name="base.yaml",
+    )
+    extra = write_yaml(
+        tmp_path,
+        """
+        commands:
+          - name: abA
+            handler: h2
+        """,
+        name="extra.yaml",
+    )
+    parser = CommandParser([base, extra])
+    with pytest.raises(ValueError, match=r"Hash collision: 'abA' and 'aab'"):
+        parser.load()
+
+
+def test_parser_conflicting_limits_across_inputs(tmp_path):
+    """The same limit with different values in two files must be rejected."""
+    base = write_yaml(
+        tmp_path,
+        """
+        limits:
+          max_tokens: 4
+        commands:
+          - name: ping
+            handler: ping_func
+        """,
+        name="base.yaml",
+    )
+    extra = write_yaml(
+        tmp_path,
+        """
+        limits:
+          max_tokens: 8
+        commands:
+          - name: reset
+            handler: reset_func
+        """,
+        name="extra.yaml",
+    )
+    parser = CommandParser([base, extra])
+    with pytest.raises(ValueError, match=r"Conflicting limit 'max_tokens'"):
+        parser.load()
+
+
+def test_parser_limits_accepted(tmp_path):
+    """A valid 'limits' section should be parsed into parser.limits."""
+    yaml = """
+    limits:
+      max_tokens: 4
+      max_arg_content_size: 128
+
+    commands:
+      - name: ping
+        handler: ping_func
+        args:
+          - type: uint8
+    """
+    file = write_yaml(tmp_path, yaml)
+    parser = CommandParser(file)
+    parser.load()
+    assert parser.limits["max_tokens"] == 4
+    assert parser.limits["max_arg_content_size"] == 128
+
+
+def test_parser_limits_unknown_key(tmp_path):
+    """Unknown keys in 'limits' should be rejected."""
+    yaml = """
+    limits:
+      max_stack_size: 1024
+
+    commands:
+      - name: ping
+        handler: ping_func
+    """
+    file = write_yaml(tmp_path, yaml)
+    parser = CommandParser(file)
+    with pytest.raises(ValueError, match="Unsupported limit key"):
+        parser.load()
+
+
+def test_parser_limits_below_widest_command(tmp_path):
+    """max_tokens smaller than the widest command must fail early."""
+    yaml = """
+    limits:
+      max_tokens: 2
+
+    commands:
+      - name: transmit
+        handler: tx_func
+        args:
+          - type: uint8_ptr
+          - type: uint8
+    """
+    file = write_yaml(tmp_path, yaml)
+    parser = CommandParser(file)
+    with pytest.raises(ValueError, match="below the 3 tokens"):
+        parser.load()
+
+
+def test_parser_limits_non_positive(tmp_path):
+    """Limit values must be positive integers."""
+    yaml = """
+    limits:
+      max_line_buf_size: 0
+
+    commands:
+      - name: ping
+        handler: ping_func
+    """
+    file = write_yaml(tmp_path, yaml)
+    parser = CommandParser(file)
+    with pytest.raises(ValueError, match="must be a positive integer"):
+        parser.load()
+
+
 def test_parser_field_order_flexibility(tmp_path):
     """Command with out-of-order fields should still parse correctly."""
     yaml = """
@@ -142,3 +342,50 @@ def test_parser_field_order_flexibility(tmp_path):
     parser = CommandParser(file)
     parser.load()
     assert parser.commands[0]["name"] == "shuffle"
+
+
+def test_parser_long_running_must_be_boolean(tmp_path):
+    """A non-boolean 'long_running' attribute should be rejected."""
+    yaml = """
+    commands:
+      - name: slow
+        handler: slow_func
+        long_running: "yes"
+    """
+    file = write_yaml(tmp_path, yaml)
+    parser = CommandParser(file)
+    with pytest.raises(ValueError, match=r"'long_running' for command 'slow'"):
+        parser.load()
+
+
+def test_parser_repeat_only_on_trailing_argument(tmp_path):
+    """'repeat: true' anywhere but the last argument should be rejected."""
+    yaml = """
+    commands:
+      - name: cal_set
+        handler: cal_set_handler
+        args:
+          - type: u16
+            repeat: true
+          - type: u8
+    """
+    file = write_yaml(tmp_path, yaml)
+    parser = CommandParser(file)
+    with pytest.raises(ValueError, match=r"only allowed on the trailing argument"):
+        parser.load()
+
+
+def test_parser_repeat_requires_scalar_type(tmp_path):
+    """'repeat: true' on a string or blob argument should be rejected."""
+    yaml = """
+    commands:
+      - name: cal_set
+        handler: cal_set_handler
+        args:
+          - type: u8p
+            repeat: true
+    """
+    file = write_yaml(tmp_path, yaml)
+    parser = CommandParser(file)
+    with pytest.raises(ValueError, match=r"requires a scalar argument type"):
+        parser.load()
@@ -37,6 +37,12 @@ TYPE_MAP = {
 }
 
 
+def is_vectored(cmd: dict) -> bool:
+    """Return True if the command's trailing argument is marked `repeat: true`."""
+    args = cmd.get("args", [])
+    return bool(args) and bool(args[-1].get("repeat", False))
+
+
 def djb2_hash(string: str) -> int:
     """Compute a 32-bit DJB2 hash."""
     hash_value = 5381
@@ -39,29 +39,31 @@ bool _test_validate_argument_count(int token_count, const ce_signature_st *sig_p
  * @brief Test wrapper for parse_arguments().
  *
  * @param sig_pst Pointer to the command signature.
- * @param tokens_ca Array of token strings (command and arguments).
+ * @param tokens_ast Array of tokens (command and arguments) with lengths.
+ * @param arg_count Number of argument tokens present (drives vectored parsing).
  * @param out_args_a Output array for parsed argument values.
  * @return true if all arguments parsed successfully.
  */
-bool _test_parse_arguments(const ce_signature_st *sig_pst, char *tokens_ca[], ce_arg_value_ut out_args_a[MAX_TOKENS]);
+bool _test_parse_arguments(const ce_signature_st *sig_pst, const ce_token_st tokens_ast[], size_t arg_count, ce_arg_value_ut out_args_a[MAX_TOKENS], ce_arena_st *arena_pst);
 
 /**
  * @brief Test wrapper for parse_line_to_tokens().
  *
  * @param line Input line to be tokenized (modified in-place).
- * @param tokens Output array of token pointers.
+ * @param tokens_ast Output array of token pointer/length pairs.
  * @param tokens_count Output count of tokens.
  * @return true on success, false on overflow or error.
  */
-bool _test_parse_line_to_tokens(char *line, char *tokens[], size_t *token_count);
+bool _test_parse_line_to_tokens(char *line, ce_token_st tokens_ast[], size_t *token_count);
 
 /**
  * @brief Test wrapper for dispatch_command().
  *
  * @param sig_pst Pointer to the command signature.
- * @param tokens_ca Tokenized input (command + arguments).
+ * @param tokens_ast Tokenized input (command + arguments) with lengths.
+ * @param tokens_count Number of tokens, including the command name.
  */
-void _test_dispatch_command(const ce_signature_st *sig_pst, char *tokens_ca[]);
+bool _test_dispatch_command(const ce_signature_st *sig_pst, const ce_token_st tokens_ast[], size_t tokens_count);
 
 /**
  * @brief Test wrapper for internal lookup_signature_by_hash().
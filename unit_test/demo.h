@@ -8,6 +8,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include "ce_types.h"
 
 bool demo_cat_string(const char* s);
 bool demo_cat_byte(uint8_t b);
@@ -20,6 +21,9 @@ bool demo_cat_mixed(const uint8_t* u8a1,
                     const uint8_t* u8a3,
                     int64_t i64,
                     uint32_t u32);
+bool demo_cal_set(uint8_t idx, const uint16_t* vals, uint8_t count);
+ce_long_status_et demo_slow_work(uint8_t slices);
+ce_long_status_et demo_slow_work_resume(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,223 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * @file perf_test.c
+ * @brief Threshold-checked performance regression gate for the dispatcher.
+ *
+ * Runs a fixed command mix (scalar-heavy, hex-heavy, unknown-command
+ * storm) through `ce_dispatch_from_line()` and compares ns/op against a
+ * per-machine baseline file in the working directory. Registered with
+ * ctest next to the functional suite, so `make run_tests` fails when the
+ * dispatcher regresses past the threshold — not only when it breaks.
+ *
+ * Usage:
+ *   perf_test            Compare against the stored baseline; without a
+ *                        baseline file the run passes and prints a hint.
+ *   perf_test --record   Measure and (re)write the baseline file.
+ *
+ * The baseline is machine-specific by design: record it once per build
+ * host (`./perf_test --record` in the build directory) and the ratio
+ * check absorbs run-to-run noise via REGRESSION_THRESHOLD.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "ce_dispatch.h"
+#include "demo.h"
+
+/* Demo handler stubs (the generated table references them) */
+bool demo_cat_string(const char* s) { (void)s; return true; }
+bool demo_cat_byte(uint8_t b) { (void)b; return true; }
+bool demo_cat_bytes(const uint8_t* data, uint8_t len) { (void)data; (void)len; return true; }
+bool demo_void(void) { return true; }
+bool demo_cat_mixed(const uint8_t* u8a1, const uint8_t* u8a2, const char* s1,
+                    const char* s2, const uint8_t* u8a3, int64_t i64, uint32_t u32)
+{
+    (void)u8a1; (void)u8a2; (void)s1; (void)s2; (void)u8a3; (void)i64; (void)u32;
+    return true;
+}
+bool demo_cal_set(uint8_t idx, const uint16_t* vals, uint8_t count)
+{
+    (void)idx; (void)vals; (void)count;
+    return true;
+}
+ce_long_status_et demo_slow_work(uint8_t slices) { (void)slices; return CE_LONG_DONE_e; }
+ce_long_status_et demo_slow_work_resume(void) { return CE_LONG_DONE_e; }
+
+#define BASELINE_FILE          "perf_baseline.txt"
+#define REGRESSION_THRESHOLD   (1.5)    /* fail when ns/op exceeds baseline * this */
+#define CALIBRATION_REPS       (20000u) /* sizing pass for the timed run */
+#define TARGET_RUN_NS          (250000000.0)  /* ~250 ms per timed workload */
+#define WORKLOAD_MAX           (8u)
+
+/**
+ * @struct perf_workload_st
+ * @brief One named command mix measured as a unit.
+ */
+typedef struct {
+    const char *name_cp;      /**< Workload identifier (baseline file key) */
+    const char *const *lines; /**< Command lines dispatched round-robin */
+    size_t line_count;        /**< Number of entries in `lines` */
+} perf_workload_st;
+
+static const char *const scalar_lines[] = {
+    "cat_byte 42",
+    "cat_byte 0xFF",
+    "cal_set 2 11 22 33",
+    "void",
+};
+
+static const char *const hex_lines[] = {
+    "cat_bytes ABABABABABABABABABABABABABABABABABABABABABABABABABABABABABABABAB 32",
+    "cat_bytes DEADBEEF 4",
+};
+
+static const char *const unknown_lines[] = {
+    "zzz_no_such_command 1 2 3",
+    "another_missing_cmd",
+};
+
+static const perf_workload_st workloads[] = {
+    { "scalar_heavy",  scalar_lines,  sizeof(scalar_lines)  / sizeof(scalar_lines[0])  },
+    { "hex_heavy",     hex_lines,     sizeof(hex_lines)     / sizeof(hex_lines[0])     },
+    { "unknown_storm", unknown_lines, sizeof(unknown_lines) / sizeof(unknown_lines[0]) },
+};
+
+#define WORKLOAD_COUNT (sizeof(workloads) / sizeof(workloads[0]))
+
+static double monotonic_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Dispatches `reps` lines of a workload round-robin, returning ns.
+ */
+static double run_reps(const perf_workload_st *w_pst, size_t reps)
+{
+    double start_ns = monotonic_ns();
+
+    for (size_t i = 0u; i < reps; ++i)
+    {
+        (void)ce_dispatch_from_line(w_pst->lines[i % w_pst->line_count]);
+    }
+
+    return monotonic_ns() - start_ns;
+}
+
+/**
+ * @brief Measures one workload's ns/op with a calibrated iteration count.
+ *
+ * A short sizing pass picks a repetition count that keeps the timed run
+ * around TARGET_RUN_NS, so the measurement is long enough to be stable on
+ * fast and slow hosts alike.
+ */
+static double measure_ns_per_op(const perf_workload_st *w_pst)
+{
+    double calib_ns = run_reps(w_pst, CALIBRATION_REPS);  /* also warms caches */
+    double per_op_ns = calib_ns / (double)CALIBRATION_REPS;
+    size_t reps = (size_t)(TARGET_RUN_NS / ((per_op_ns > 1.0) ? per_op_ns : 1.0));
+
+    if (reps < CALIBRATION_REPS)
+    {
+        reps = CALIBRATION_REPS;
+    }
+
+    return run_reps(w_pst, reps) / (double)reps;
+}
+
+/**
+ * @brief Loads a baseline value by workload name; false if absent.
+ */
+static bool baseline_lookup(const char *name_cp, double *out_ns_p)
+{
+    FILE *f = fopen(BASELINE_FILE, "r");
+    char key_ca[64];
+    double value = 0.0;
+    bool found_b = false;
+
+    if (NULL == f)
+    {
+        return false;
+    }
+
+    while (fscanf(f, "%63s %lf", key_ca, &value) == 2)
+    {
+        if (0 == strcmp(key_ca, name_cp))
+        {
+            *out_ns_p = value;
+            found_b = true;
+            break;
+        }
+    }
+
+    fclose(f);
+    return found_b;
+}
+
+int main(int argc, char *argv[])
+{
+    bool record_b = (argc > 1) && (0 == strcmp(argv[1], "--record"));
+    double results[WORKLOAD_MAX];
+    int failures = 0;
+
+    /* The UNIT_TEST build of the engine prints every logged error to
+     * stdout; silence it so the unknown-command storm measures dispatch,
+     * not console formatting. All reporting goes to stderr.
+     */
+    (void)freopen("/dev/null", "w", stdout);
+
+    for (size_t i = 0u; i < WORKLOAD_COUNT; ++i)
+    {
+        results[i] = measure_ns_per_op(&workloads[i]);
+        fprintf(stderr, "%-14s %10.1f ns/op\n", workloads[i].name_cp, results[i]);
+    }
+
+    if (record_b)
+    {
+        FILE *f = fopen(BASELINE_FILE, "w");
+
+        if (NULL == f)
+        {
+            fprintf(stderr, "cannot write %s\n", BASELINE_FILE);
+            return 1;
+        }
+
+        for (size_t i = 0u; i < WORKLOAD_COUNT; ++i)
+        {
+            fprintf(f, "%s %.1f\n", workloads[i].name_cp, results[i]);
+        }
+
+        fclose(f);
+        fprintf(stderr, "baseline recorded to %s\n", BASELINE_FILE);
+        return 0;
+    }
+
+    for (size_t i = 0u; i < WORKLOAD_COUNT; ++i)
+    {
+        double baseline_ns = 0.0;
+
+        if (!baseline_lookup(workloads[i].name_cp, &baseline_ns))
+        {
+            fprintf(stderr, "%-14s no baseline (run './perf_test --record'), skipping\n",
+                    workloads[i].name_cp);
+            continue;
+        }
+
+        if (results[i] > (baseline_ns * REGRESSION_THRESHOLD))
+        {
+            fprintf(stderr, "%-14s REGRESSION: %.1f ns/op vs baseline %.1f (limit %.1f)\n",
+                    workloads[i].name_cp, results[i], baseline_ns,
+                    baseline_ns * REGRESSION_THRESHOLD);
+            failures++;
+        }
+    }
+
+    return (0 == failures) ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "ce_ctx.h"
+#include "ce_dispatch.h"
+#include "ce_out.h"
+#include "logger.h"
+}
+
+// The demo_* handler mocks are defined in test_dispatch.cpp (same binary).
+
+namespace {
+
+std::vector<uint8_t> ctx_sink_captured;
+
+size_t ctx_capture_sink(const uint8_t* data, size_t len) {
+    ctx_sink_captured.insert(ctx_sink_captured.end(), data, data + len);
+    return len;
+}
+
+size_t ctx_discard_sink(const uint8_t*, size_t len) { return len; }
+
+void ctx_discard_formatter(const log_record_st*) {}
+
+// Restores the default context even when a test body fails mid-way.
+class Ctx : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ce_ctx_activate(nullptr);
+        ctx_sink_captured.clear();
+    }
+    void TearDown() override { ce_ctx_activate(nullptr); }
+};
+
+}  // namespace
+
+TEST_F(Ctx, DefaultContextIsActiveInitially) {
+    EXPECT_EQ(ce_ctx_active(), ce_ctx_default());
+}
+
+TEST_F(Ctx, ActivateSelectsAndNullRestoresDefault) {
+    static ce_ctx_st ctx;
+    ce_ctx_activate(&ctx);
+    EXPECT_EQ(ce_ctx_active(), &ctx);
+
+    ce_ctx_activate(nullptr);
+    EXPECT_EQ(ce_ctx_active(), ce_ctx_default());
+}
+
+TEST_F(Ctx, OutputRingsAreIsolatedPerContext) {
+    static ce_ctx_st ctx;
+    ce_ctx_init(&ctx);
+    (void)ce_out_drain(ctx_discard_sink);  // flush the default ring
+
+    ce_ctx_activate(&ctx);
+    EXPECT_EQ(ce_out_write_str("ctx"), 3u);
+    EXPECT_EQ(ce_out_pending(), 3u);
+
+    // The default context saw none of it.
+    ce_ctx_activate(nullptr);
+    EXPECT_EQ(ce_out_pending(), 0u);
+
+    ce_ctx_activate(&ctx);
+    EXPECT_EQ(ce_out_drain(ctx_capture_sink), 3u);
+    EXPECT_EQ(std::string(ctx_sink_captured.begin(), ctx_sink_captured.end()), "ctx");
+}
+
+TEST_F(Ctx, LogRingsAreIsolatedPerContext) {
+    static ce_ctx_st ctx;
+    ce_ctx_init(&ctx);
+    (void)log_drain(ctx_discard_formatter);  // flush the default ring
+
+    ce_ctx_activate(&ctx);
+    log_event(CE_FILE_CTX_e, 1u);
+    log_event(CE_FILE_CTX_e, 2u);
+
+    ce_ctx_activate(nullptr);
+    EXPECT_EQ(log_drain(ctx_discard_formatter), 0u);
+
+    ce_ctx_activate(&ctx);
+    EXPECT_EQ(log_drain(ctx_discard_formatter), 2u);
+}
+
+TEST_F(Ctx, DispatchCtxRunsAndRestoresPreviousContext) {
+    static ce_ctx_st ctx_a;
+    static ce_ctx_st ctx_b;
+    ce_ctx_init(&ctx_a);
+    ce_ctx_init(&ctx_b);
+
+    ce_ctx_activate(&ctx_a);
+    EXPECT_TRUE(ce_dispatch_ctx(&ctx_b, "void"));
+    EXPECT_EQ(ce_ctx_active(), &ctx_a);
+
+    // Errors during the call landed in ctx_b's ring, not ctx_a's.
+    EXPECT_FALSE(ce_dispatch_ctx(&ctx_b, "no_such_command"));
+    EXPECT_EQ(log_drain(ctx_discard_formatter), 0u);
+    ce_ctx_activate(&ctx_b);
+    EXPECT_GE(log_drain(ctx_discard_formatter), 1u);
+}
+
+TEST_F(Ctx, InitResetsAContextToEmpty) {
+    static ce_ctx_st ctx;
+    ce_ctx_activate(&ctx);
+    EXPECT_EQ(ce_out_write_str("stale"), 5u);
+    log_event(CE_FILE_CTX_e, 1u);
+
+    ce_ctx_init(&ctx);
+    EXPECT_EQ(ce_out_pending(), 0u);
+    EXPECT_EQ(log_drain(ctx_discard_formatter), 0u);
+    EXPECT_EQ(log_dropped(), 0u);
+}
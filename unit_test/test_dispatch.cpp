@@ -38,10 +38,12 @@ typedef struct {
 } mixed_mock_st;
 static mixed_mock_st g_mixed_mock;
 
+static bool g_force_handler_fail = false;
+
 extern "C" bool demo_cat_byte(uint8_t value) {
     g_last_byte = value;
     g_mock_calls++;
-    return true;
+    return !g_force_handler_fail;
 }
 
 extern "C" bool demo_cat_string(const char* str) {
@@ -80,12 +82,25 @@ extern "C" bool demo_cat_mixed(const uint8_t* u8a1,
     return true;
 }
 
+static uint8_t g_cal_idx = 0xFF;
+static std::vector<uint16_t> g_cal_vals;
+
+extern "C" bool demo_cal_set(uint8_t idx, const uint16_t* vals, uint8_t count) {
+    g_cal_idx = idx;
+    g_cal_vals.assign(vals, vals + count);
+    g_mock_calls++;
+    return true;
+}
+
 static void reset_mock_state() {
     g_last_string.clear();
     g_last_bytes.clear();
     g_last_byte = 0xFF;
     g_mock_calls = 0;
     g_void_called = false;
+    g_force_handler_fail = false;
+    g_cal_idx = 0xFF;
+    g_cal_vals.clear();
 }
 
 static void reset_mixed_mock() {
@@ -153,17 +168,288 @@ TEST(Dispatch_E2E, CatMixedComplex) {
     EXPECT_EQ(g_mixed_mock.u32, 987654321U);
 }
 
+TEST(Dispatch_E2E, InplaceCatByte) {
+    reset_mock_state();
+    char line[] = "cat_byte 99";
+    EXPECT_TRUE(ce_dispatch_from_line_inplace(line, strlen(line)));
+    EXPECT_EQ(g_mock_calls, 1);
+    EXPECT_EQ(g_last_byte, 99);
+}
+
+TEST(Dispatch_E2E, InplaceRejectsBadLength) {
+    reset_mock_state();
+    char line[] = "cat_byte 99";
+    // line[len] is '9', not the terminator
+    EXPECT_FALSE(ce_dispatch_from_line_inplace(line, strlen(line) - 1));
+    EXPECT_EQ(g_mock_calls, 0);
+}
+
+TEST(Dispatch_Batch, AllLinesDispatched) {
+    reset_mock_state();
+    char buf[] = "cat_byte 1\nvoid\n\ncat_byte 2\n";
+    ce_batch_result_st result = {};
+    EXPECT_TRUE(ce_dispatch_from_buffer(buf, strlen(buf), &result));
+    EXPECT_EQ(result.dispatched_u32, 3u);
+    EXPECT_EQ(result.failed_u32, 0u);
+    EXPECT_EQ(result.first_error_offset, SIZE_MAX);
+    EXPECT_EQ(g_last_byte, 2);
+}
+
+TEST(Dispatch_Batch, ReportsFirstErrorOffset) {
+    reset_mock_state();
+    char buf[] = "void\nbogus_cmd\ncat_byte 7";
+    ce_batch_result_st result = {};
+    EXPECT_FALSE(ce_dispatch_from_buffer(buf, strlen(buf), &result));
+    EXPECT_EQ(result.dispatched_u32, 2u);
+    EXPECT_EQ(result.failed_u32, 1u);
+    EXPECT_EQ(result.first_error_offset, 5u);  // offset of "bogus_cmd"
+    EXPECT_EQ(g_last_byte, 7);
+}
+
+TEST(Dispatch_Batch, BlankBufferSucceeds) {
+    reset_mock_state();
+    char buf[] = "\n  \n\r\n";
+    ce_batch_result_st result = {};
+    EXPECT_TRUE(ce_dispatch_from_buffer(buf, strlen(buf), &result));
+    EXPECT_EQ(result.dispatched_u32, 0u);
+    EXPECT_EQ(result.failed_u32, 0u);
+    EXPECT_EQ(g_mock_calls, 0);
+}
+
+TEST(Dispatch_TwoPhase, ParseOnceInvokeMany) {
+    reset_mock_state();
+    static ce_parsed_cmd_st parsed;
+    ASSERT_TRUE(ce_parse_line("cat_byte 42", &parsed));
+    EXPECT_EQ(g_mock_calls, 0);  // parsing must not invoke
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(ce_invoke_parsed(&parsed));
+    }
+    EXPECT_EQ(g_mock_calls, 3);
+    EXPECT_EQ(g_last_byte, 42);
+}
+
+TEST(Dispatch_TwoPhase, ParsedObjectIsSelfContained) {
+    reset_mock_state();
+    static ce_parsed_cmd_st parsed;
+    {
+        std::string line = "cat_bytes 0A0B0C 3";
+        ASSERT_TRUE(ce_parse_line(line.c_str(), &parsed));
+    }  // source line destroyed before invocation
+    EXPECT_TRUE(ce_invoke_parsed(&parsed));
+    EXPECT_EQ(g_last_bytes, (std::vector<uint8_t>{0x0A, 0x0B, 0x0C}));
+}
+
+TEST(Dispatch_TwoPhase, ParseRejectsUnknownCommand) {
+    static ce_parsed_cmd_st parsed;
+    EXPECT_FALSE(ce_parse_line("not_a_command 1", &parsed));
+    EXPECT_FALSE(ce_parse_line(nullptr, &parsed));
+    EXPECT_FALSE(ce_parse_line("void", nullptr));
+}
+
+// -----------------------------------------------------------------------------
+// Status Dispatch Tests
+// -----------------------------------------------------------------------------
+
+TEST(Dispatch_Status, SuccessReturnsOk) {
+    reset_mock_state();
+    ce_error_info_st info = {};
+    EXPECT_EQ(ce_dispatch_from_line_status("cat_byte 42", &info), CE_STATUS_OK_e);
+    EXPECT_EQ(info.hash_u32, ce_hash_calculate("cat_byte"));
+    EXPECT_EQ(g_last_byte, 42);
+}
+
+TEST(Dispatch_Status, BadInput) {
+    ce_error_info_st info = {};
+    EXPECT_EQ(ce_dispatch_from_line_status(nullptr, &info), CE_STATUS_BAD_INPUT_e);
+    EXPECT_EQ(ce_dispatch_from_line_status("   \t ", &info), CE_STATUS_BAD_INPUT_e);
+
+    std::string oversized(MAX_LINE_BUF_SIZE + 1, 'x');
+    EXPECT_EQ(ce_dispatch_from_line_status(oversized.c_str(), &info), CE_STATUS_BAD_INPUT_e);
+}
+
+TEST(Dispatch_Status, UnknownCommandReportsHash) {
+    ce_error_info_st info = {};
+    EXPECT_EQ(ce_dispatch_from_line_status("not_a_command", &info),
+              CE_STATUS_UNKNOWN_COMMAND_e);
+    EXPECT_EQ(info.hash_u32, ce_hash_calculate("not_a_command"));
+}
+
+TEST(Dispatch_Status, ArgCountMismatchReportsCounts) {
+    ce_error_info_st info = {};
+    EXPECT_EQ(ce_dispatch_from_line_status("cat_byte 1 2 3", &info), CE_STATUS_ARG_COUNT_e);
+    EXPECT_EQ(info.expected_u8, 1u);
+    EXPECT_EQ(info.got_u8, 3u);
+}
+
+TEST(Dispatch_Status, ParseFailureReportsTokenIndex) {
+    ce_error_info_st info = {};
+    EXPECT_EQ(ce_dispatch_from_line_status("cat_byte zz", &info), CE_STATUS_PARSE_FAIL_e);
+    EXPECT_EQ(info.token_idx_u8, 1u);
+
+    // cat_mixed: (u8p, u8p, s, s, u8p, i64, u32) — bad i64 is token 6.
+    EXPECT_EQ(ce_dispatch_from_line_status("cat_mixed 0102 0A0B s1 s2 FF bad 7", &info),
+              CE_STATUS_PARSE_FAIL_e);
+    EXPECT_EQ(info.token_idx_u8, 6u);
+}
+
+TEST(Dispatch_Status, HandlerFailureIsDistinctFromParseFailure) {
+    reset_mock_state();
+    g_force_handler_fail = true;
+    EXPECT_EQ(ce_dispatch_from_line_status("cat_byte 1", nullptr), CE_STATUS_HANDLER_FAIL_e);
+    g_force_handler_fail = false;
+    EXPECT_EQ(ce_dispatch_from_line_status("cat_byte 1", nullptr), CE_STATUS_OK_e);
+}
+
+// -----------------------------------------------------------------------------
+// Arena Dispatch Tests
+// -----------------------------------------------------------------------------
+
+TEST(Dispatch_Arena, BlobLargerThanInternalScratch) {
+    reset_mock_state();
+    static uint8_t storage[512];
+    ce_arena_st arena = { storage, sizeof(storage), 0u };
+
+    // 100 blob bytes: exceeds MAX_ARG_CONTENT_SIZE (64), fits the arena.
+    std::string hex;
+    for (int i = 0; i < 100; ++i) {
+        char byte[3];
+        snprintf(byte, sizeof(byte), "%02X", i);
+        hex += byte;
+    }
+    std::string line = "cat_bytes " + hex + " 100";
+
+    EXPECT_TRUE(ce_dispatch_from_line_ex(line.c_str(), &arena));
+    ASSERT_EQ(g_last_bytes.size(), 100u);
+    EXPECT_EQ(g_last_bytes[99], 99u);
+    EXPECT_EQ(arena.used, 100u);
+}
+
+TEST(Dispatch_Arena, SecondBlobBoundedByRemainingSpace) {
+    reset_mock_state();
+    static uint8_t storage[8];
+    ce_arena_st arena = { storage, sizeof(storage), 0u };
+
+    // 6 + 6 blob bytes exceed the 8-byte arena: the second blob must be
+    // rejected against remaining space, not total capacity.
+    EXPECT_FALSE(ce_dispatch_from_line_ex(
+        "cat_mixed 010203040506 0A0B0C0D0E0F s1 s2 FF -5 7", &arena));
+
+    arena.used = 0u;
+    EXPECT_TRUE(ce_dispatch_from_line_ex(
+        "cat_mixed 0102 0A0B s1 s2 FF -5 7", &arena));
+    EXPECT_EQ(arena.used, 5u);
+}
+
+TEST(Dispatch_Arena, UsedAdvancesAcrossDispatches) {
+    reset_mock_state();
+    static uint8_t storage[32];
+    ce_arena_st arena = { storage, sizeof(storage), 0u };
+
+    EXPECT_TRUE(ce_dispatch_from_line_ex("cat_bytes 0A0B0C 3", &arena));
+    EXPECT_EQ(arena.used, 3u);
+    EXPECT_TRUE(ce_dispatch_from_line_ex("cat_bytes 0D0E 2", &arena));
+    EXPECT_EQ(arena.used, 5u);
+    // First blob still intact behind the bump pointer.
+    EXPECT_EQ(storage[0], 0x0A);
+}
+
+TEST(Dispatch_Arena, RejectsInvalidArena) {
+    static uint8_t storage[8];
+    ce_arena_st null_base = { nullptr, 8u, 0u };
+    ce_arena_st overcommitted = { storage, 8u, 9u };
+
+    EXPECT_FALSE(ce_dispatch_from_line_ex("void", nullptr));
+    EXPECT_FALSE(ce_dispatch_from_line_ex("void", &null_base));
+    EXPECT_FALSE(ce_dispatch_from_line_ex("void", &overcommitted));
+    EXPECT_FALSE(ce_dispatch_from_line_ex(nullptr, &null_base));
+}
+
+// -----------------------------------------------------------------------------
+// Vectored (repeat: true) Command Tests
+// -----------------------------------------------------------------------------
+
+TEST(Dispatch_Vector, SingleValueReachesHandlerAsPointerPlusCount) {
+    reset_mock_state();
+    EXPECT_TRUE(ce_dispatch_from_line("cal_set 3 100"));
+    EXPECT_EQ(g_cal_idx, 3);
+    ASSERT_EQ(g_cal_vals.size(), 1u);
+    EXPECT_EQ(g_cal_vals[0], 100);
+}
+
+TEST(Dispatch_Vector, BulkValuesArriveInOneDispatch) {
+    reset_mock_state();
+    // MAX_TOKENS(8) - command - idx leaves room for 6 values.
+    EXPECT_TRUE(ce_dispatch_from_line("cal_set 7 10 20 30 40 50 65535"));
+    EXPECT_EQ(g_cal_idx, 7);
+    ASSERT_EQ(g_cal_vals.size(), 6u);
+    EXPECT_EQ(g_cal_vals[0], 10);
+    EXPECT_EQ(g_cal_vals[5], 65535);
+    EXPECT_EQ(g_mock_calls, 1);
+}
+
+TEST(Dispatch_Vector, MissingTrailingValuesIsArgCountError) {
+    reset_mock_state();
+    EXPECT_FALSE(ce_dispatch_from_line("cal_set 3"));
+    EXPECT_EQ(g_mock_calls, 0);
+}
+
+TEST(Dispatch_Vector, BadRepeatedValueIsParseError) {
+    reset_mock_state();
+    EXPECT_FALSE(ce_dispatch_from_line("cal_set 3 10 zz 30"));
+    EXPECT_EQ(g_mock_calls, 0);
+}
+
+TEST(Dispatch_Vector, SignatureEncodesRepetitionRange) {
+    const ce_signature_st* sig =
+        _test_lookup_signature_by_hash(ce_hash_calculate("cal_set"));
+    ASSERT_NE(sig, nullptr);
+    EXPECT_EQ(sig->type_count_u8, 2);
+    EXPECT_EQ(sig->repeat_min_u8, 1);
+    EXPECT_EQ(sig->repeat_max_u8, MAX_TOKENS - 2);
+    EXPECT_EQ(sig->exec_fn, nullptr);  // generic path only
+
+    const ce_signature_st* fixed =
+        _test_lookup_signature_by_hash(ce_hash_calculate("cat_byte"));
+    ASSERT_NE(fixed, nullptr);
+    EXPECT_EQ(fixed->repeat_max_u8, 0);
+}
+
+TEST(Dispatch_Vector, StatusPathReportsRangeViolations) {
+    reset_mock_state();
+    ce_error_info_st info;
+    EXPECT_EQ(ce_dispatch_from_line_status("cal_set 1 2 3", &info), CE_STATUS_OK_e);
+    EXPECT_EQ(g_cal_vals.size(), 2u);
+    EXPECT_EQ(ce_dispatch_from_line_status("cal_set 1", &info), CE_STATUS_ARG_COUNT_e);
+}
+
+TEST(Dispatch_Vector, ParsedObjectReplaysWithStoredCount) {
+    reset_mock_state();
+    static ce_parsed_cmd_st parsed;
+    ASSERT_TRUE(ce_parse_line("cal_set 2 11 22 33", &parsed));
+    EXPECT_TRUE(ce_invoke_parsed(&parsed));
+    EXPECT_TRUE(ce_invoke_parsed(&parsed));
+    EXPECT_EQ(g_mock_calls, 2);
+    ASSERT_EQ(g_cal_vals.size(), 3u);
+    EXPECT_EQ(g_cal_vals[2], 33);
+}
+
 // -----------------------------------------------------------------------------
 // Argument Parsing Tests
 // -----------------------------------------------------------------------------
 
+// Builds a ce_token_st from a null-terminated literal, as the tokenizer would.
+static ce_token_st tok(const char* s) {
+    return ce_token_st{ s, (uint16_t)strlen(s) };
+}
+
 TEST(ParseArguments, Uint8Parse) {
     reset_mock_state();
     ce_arg_type_et types[] = { TYPE_UINT8_e };
     ce_signature_st sig = { .types_e = types, .type_count_u8 = 1 };
-    char* tokens[] = { (char*)"cmd", (char*)"42" };
+    ce_token_st tokens[] = { tok("cmd"), tok("42") };
     ce_arg_value_ut args[MAX_TOKENS] = {};
-    EXPECT_TRUE(_test_parse_arguments(&sig, tokens, args));
+    EXPECT_TRUE(_test_parse_arguments(&sig, tokens, 1u, args, nullptr));
     EXPECT_EQ(args[0].u8, 42);
 }
 
@@ -171,17 +457,17 @@ TEST(ParseArguments, RejectInvalidUint8) {
     reset_mock_state();
     ce_arg_type_et types[] = { TYPE_UINT8_e };
     ce_signature_st sig = { .types_e = types, .type_count_u8 = 1 };
-    char* tokens[] = { (char*)"cmd", (char*)"not_a_number" };
+    ce_token_st tokens[] = { tok("cmd"), tok("not_a_number") };
     ce_arg_value_ut args[MAX_TOKENS] = {};
-    EXPECT_FALSE(_test_parse_arguments(&sig, tokens, args));
+    EXPECT_FALSE(_test_parse_arguments(&sig, tokens, 1u, args, nullptr));
 }
 
 TEST(ParseArguments, MixedTypesParseCorrectly) {
     ce_arg_type_et types[] = { TYPE_UINT8_e, TYPE_STRING_e, TYPE_UINT32_e };
     ce_signature_st sig = { .types_e = types, .type_count_u8 = 3 };
-    char* tokens[] = { (char*)"cmd", (char*)"123", (char*)"abc", (char*)"4294967295" };
+    ce_token_st tokens[] = { tok("cmd"), tok("123"), tok("abc"), tok("4294967295") };
     ce_arg_value_ut args[MAX_TOKENS] = {};
-    EXPECT_TRUE(_test_parse_arguments(&sig, tokens, args));
+    EXPECT_TRUE(_test_parse_arguments(&sig, tokens, 3u, args, nullptr));
     EXPECT_EQ(args[0].u8, 123);
     EXPECT_STREQ(args[1].str_cp, "abc");
     EXPECT_EQ(args[2].u32, 4294967295U);
@@ -194,22 +480,51 @@ TEST(ParseArguments, MixedTypesParseCorrectly) {
 TEST(ParseTokens, HandlesWhitespace) {
     reset_mock_state();
     char line[] = "   echo   arg1   arg2  ";
-    char* tokens[MAX_TOKENS] = {};
+    ce_token_st tokens[MAX_TOKENS] = {};
     size_t token_count = 0u;
     printf("line strlen : %lu\n", strlen(line));
     EXPECT_TRUE(_test_parse_line_to_tokens(line, tokens, &token_count));
     EXPECT_EQ(token_count, 3);
 
-    EXPECT_STREQ(tokens[0], "echo");
-    EXPECT_STREQ(tokens[1], "arg1");
-    EXPECT_STREQ(tokens[2], "arg2");
+    EXPECT_STREQ(tokens[0].ptr_cp, "echo");
+    EXPECT_STREQ(tokens[1].ptr_cp, "arg1");
+    EXPECT_STREQ(tokens[2].ptr_cp, "arg2");
+}
+
+TEST(ParseTokens, RecordsTokenLengths) {
+    // Lengths must match the null-terminated strings exactly: later stages
+    // (hashing, hex decoding) trust them and never re-scan the bytes.
+    reset_mock_state();
+    char line[] = "cat_bytes AABBCC 3";
+    ce_token_st tokens[MAX_TOKENS] = {};
+    size_t token_count = 0u;
+    EXPECT_TRUE(_test_parse_line_to_tokens(line, tokens, &token_count));
+    ASSERT_EQ(token_count, 3);
+    EXPECT_EQ(tokens[0].len_u16, strlen(tokens[0].ptr_cp));
+    EXPECT_EQ(tokens[1].len_u16, 6u);
+    EXPECT_EQ(tokens[2].len_u16, 1u);
+}
+
+TEST(ParseTokens, LongTokensCrossScanBlocks) {
+    // Tokens longer than one SIMD/SWAR block must still split correctly.
+    reset_mock_state();
+    char line[] = "cmd aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\tbbbbbbbbbbbbbbbbbbbbbbbbb  cc";
+    ce_token_st tokens[MAX_TOKENS] = {};
+    size_t token_count = 0u;
+    EXPECT_TRUE(_test_parse_line_to_tokens(line, tokens, &token_count));
+    EXPECT_EQ(token_count, 4);
+    EXPECT_STREQ(tokens[0].ptr_cp, "cmd");
+    EXPECT_STREQ(tokens[1].ptr_cp, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+    EXPECT_STREQ(tokens[2].ptr_cp, "bbbbbbbbbbbbbbbbbbbbbbbbb");
+    EXPECT_STREQ(tokens[3].ptr_cp, "cc");
+    EXPECT_EQ(tokens[1].len_u16, 40u);
 }
 
 TEST(ParseTokens, RejectsTooManyTokens) {
     reset_mock_state();
     char line[1024] = "cmd";
     for (int i = 0; i < MAX_TOKENS; ++i) strcat(line, " arg");
-    char* tokens[MAX_TOKENS] = {};
+    ce_token_st tokens[MAX_TOKENS] = {};
     size_t token_count = 0u;
     EXPECT_FALSE(_test_parse_line_to_tokens(line, tokens, &token_count));
 }
@@ -262,7 +577,7 @@ TEST(InvokeHandler, UnknownHashReturnsFalse) {
     };
 
     ce_arg_value_ut args[MAX_TOKENS] = {};
-    EXPECT_FALSE(ce_invoke_handler(&sig, args));
+    EXPECT_FALSE(ce_invoke_handler(&sig, args, 0u));
 }
 
 TEST(ValidateArgumentCount, NullSignatureReturnsFalse) {
@@ -279,3 +594,88 @@ TEST(SignatureLookup, EveryCommandHashResolves) {
         EXPECT_EQ(match->hash_u32, sigs[i].hash_u32);
     }
 }
+
+TEST(TablePrefix, NamesAreSortedAndComplete) {
+    auto count = ce_table_get_signatures_count();
+    auto names = ce_table_get_names();
+
+    for (size_t i = 1; i < count; ++i) {
+        EXPECT_LT(strcmp(names[i - 1], names[i]), 0);
+    }
+}
+
+TEST(TablePrefix, FindsMatchingRange) {
+    size_t first = SIZE_MAX;
+    auto names = ce_table_get_names();
+
+    // Demo set: cat_byte, cat_bytes, cat_mixed, cat_string, void
+    EXPECT_EQ(ce_table_find_prefix("cat_", &first), 4u);
+    EXPECT_STREQ(names[first], "cat_byte");
+
+    EXPECT_EQ(ce_table_find_prefix("cat_byte", &first), 2u);
+    EXPECT_STREQ(names[first], "cat_byte");
+    EXPECT_STREQ(names[first + 1], "cat_bytes");
+
+    EXPECT_EQ(ce_table_find_prefix("void", &first), 1u);
+    EXPECT_STREQ(names[first], "void");
+}
+
+TEST(TablePrefix, EmptyPrefixMatchesAll) {
+    size_t first = SIZE_MAX;
+    EXPECT_EQ(ce_table_find_prefix("", &first), ce_table_get_signatures_count());
+    EXPECT_EQ(first, 0u);
+}
+
+TEST(TablePrefix, NoMatchAndNullInputs) {
+    size_t first = 0;
+    EXPECT_EQ(ce_table_find_prefix("zz", &first), 0u);
+    EXPECT_EQ(ce_table_find_prefix(nullptr, &first), 0u);
+    EXPECT_EQ(ce_table_find_prefix("cat_", nullptr), 0u);
+}
+
+TEST(FusedExec, ParsesAndInvokesDirectly) {
+    // The stats build routes dispatch through the generic path, so call the
+    // generated fused function through the table entry directly.
+    const ce_signature_st* sig =
+        _test_lookup_signature_by_hash(ce_hash_calculate("cat_bytes"));
+    ASSERT_NE(sig, nullptr);
+    ASSERT_NE(sig->exec_fn, nullptr);
+
+    char tok0[] = "cat_bytes";
+    char tok1[] = "AABBCC";
+    char tok2[] = "3";
+    char* tokens[MAX_TOKENS] = { tok0, tok1, tok2 };
+
+    g_last_bytes.clear();
+    EXPECT_TRUE(sig->exec_fn(tokens));
+    EXPECT_EQ(g_last_bytes, (std::vector<uint8_t>{0xAA, 0xBB, 0xCC}));
+}
+
+TEST(FusedExec, RejectsUnparsableToken) {
+    const ce_signature_st* sig =
+        _test_lookup_signature_by_hash(ce_hash_calculate("cat_byte"));
+    ASSERT_NE(sig, nullptr);
+    ASSERT_NE(sig->exec_fn, nullptr);
+
+    char tok0[] = "cat_byte";
+    char tok1[] = "300";  // exceeds uint8_t
+    char* tokens[MAX_TOKENS] = { tok0, tok1 };
+
+    EXPECT_FALSE(sig->exec_fn(tokens));
+}
+
+TEST(SignatureLookup, RepeatedLookupsStayConsistent) {
+    // The test build enables CE_LOOKUP_CACHE_SIZE, so the second and later
+    // lookups of the same hash are served from the direct-mapped cache; the
+    // result must be identical to the cold lookup, and unknown hashes must
+    // keep failing regardless of what landed in their cache slot.
+    auto count = ce_table_get_signatures_count();
+    auto sigs = ce_table_get_signatures();
+
+    for (int pass = 0; pass < 3; ++pass) {
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(_test_lookup_signature_by_hash(sigs[i].hash_u32), &sigs[i]);
+        }
+        EXPECT_EQ(_test_lookup_signature_by_hash(0xDEADBEEFu), nullptr);
+    }
+}
@@ -0,0 +1,83 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <cstring>
+
+extern "C" {
+#include "ce_frame.h"
+#include "ce_hash.h"
+#include "ce_frame_layout.h"
+}
+
+// The demo_* handler mocks are defined in test_dispatch.cpp (same binary);
+// frame tests only validate decode/validation behavior through the return
+// value, so no handler state inspection is needed here.
+
+static void append_le32(std::vector<uint8_t>& f, uint32_t v) {
+    f.push_back(v & 0xFF);
+    f.push_back((v >> 8) & 0xFF);
+    f.push_back((v >> 16) & 0xFF);
+    f.push_back((v >> 24) & 0xFF);
+}
+
+TEST(Frame, DispatchNoArgCommand) {
+    std::vector<uint8_t> frame;
+    append_le32(frame, CE_FRAME_VOID_HASH);
+    EXPECT_TRUE(ce_dispatch_from_frame(frame.data(), frame.size()));
+}
+
+TEST(Frame, DispatchScalarCommand) {
+    std::vector<uint8_t> frame;
+    append_le32(frame, CE_FRAME_CAT_BYTE_HASH);
+    frame.push_back(0x2A);  // u8 argument
+    EXPECT_TRUE(ce_dispatch_from_frame(frame.data(), frame.size()));
+}
+
+TEST(Frame, DispatchBlobCommand) {
+    std::vector<uint8_t> frame;
+    append_le32(frame, CE_FRAME_CAT_BYTES_HASH);
+    frame.push_back(3);  // blob length prefix
+    frame.push_back(0xAA);
+    frame.push_back(0xBB);
+    frame.push_back(0xCC);
+    frame.push_back(3);  // u8 count argument
+    EXPECT_TRUE(ce_dispatch_from_frame(frame.data(), frame.size()));
+}
+
+TEST(Frame, DispatchStringCommand) {
+    std::vector<uint8_t> frame;
+    append_le32(frame, CE_FRAME_CAT_STRING_HASH);
+    const char* str = "hello";
+    frame.push_back(5);  // string length prefix
+    frame.insert(frame.end(), str, str + 5);
+    EXPECT_TRUE(ce_dispatch_from_frame(frame.data(), frame.size()));
+}
+
+TEST(Frame, RejectsMalformedFrames) {
+    std::vector<uint8_t> frame;
+    append_le32(frame, CE_FRAME_CAT_BYTE_HASH);
+
+    // Missing the u8 argument entirely
+    EXPECT_FALSE(ce_dispatch_from_frame(frame.data(), frame.size()));
+
+    // Trailing garbage after a valid argument
+    frame.push_back(0x01);
+    frame.push_back(0xFF);
+    EXPECT_FALSE(ce_dispatch_from_frame(frame.data(), frame.size()));
+
+    // Unknown hash
+    std::vector<uint8_t> bogus;
+    append_le32(bogus, 0xDEADBEEF);
+    EXPECT_FALSE(ce_dispatch_from_frame(bogus.data(), bogus.size()));
+
+    // Too short for a hash
+    EXPECT_FALSE(ce_dispatch_from_frame(bogus.data(), 2));
+    EXPECT_FALSE(ce_dispatch_from_frame(nullptr, 8));
+}
+
+TEST(Frame, MinSizeConstantsMatchWireFormat) {
+    EXPECT_EQ(CE_FRAME_VOID_MIN_SIZE, CE_FRAME_HASH_SIZE);
+    EXPECT_EQ(CE_FRAME_CAT_BYTE_MIN_SIZE, CE_FRAME_HASH_SIZE + 1u);
+    EXPECT_EQ(CE_FRAME_CAT_BYTES_MIN_SIZE, CE_FRAME_HASH_SIZE + 1u + 1u);
+}
@@ -22,3 +22,12 @@ TEST(CeHashTest, CaseSensitivity)
 {
     EXPECT_NE(ce_hash_calculate("Reset"), ce_hash_calculate("reset"));
 }
+
+TEST(CeHashTest, LengthVariantMatchesStringVariant)
+{
+    EXPECT_EQ(ce_hash_calculate_n("set_speed", 9u), ce_hash_calculate("set_speed"));
+    EXPECT_EQ(ce_hash_calculate_n("", 0u), 5381u);
+
+    // Only the first `len` bytes participate: trailing garbage is ignored.
+    EXPECT_EQ(ce_hash_calculate_n("reset junk", 5u), ce_hash_calculate("reset"));
+}
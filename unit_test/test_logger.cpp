@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+extern "C" {
+#include "logger.h"
+}
+
+namespace {
+
+std::vector<log_record_st> g_records;
+
+void capture_formatter(const log_record_st* record) {
+    g_records.push_back(*record);
+}
+
+void discard_formatter(const log_record_st*) {}
+
+uint32_t fake_timestamp() { return 0xCAFE0000u; }
+
+// Other test suites log through the same ring; start each test from an
+// empty ring so counts are deterministic.
+void flush_ring() {
+    (void)log_drain(discard_formatter);
+    g_records.clear();
+}
+
+}  // namespace
+
+TEST(Logger, RecordsAndDrainsBinaryRecords) {
+    flush_ring();
+
+    log_event(CE_FILE_DISPATCH_e, 123);
+    log_event_args(CE_FILE_QUEUE_e, 456, 0xAABBCCDDu, 42u);
+
+    EXPECT_EQ(log_drain(capture_formatter), 2u);
+    ASSERT_EQ(g_records.size(), 2u);
+
+    EXPECT_EQ(g_records[0].file_id_u8, CE_FILE_DISPATCH_e);
+    EXPECT_EQ(g_records[0].line_u16, 123u);
+    EXPECT_EQ(g_records[0].arg_count_u8, 0u);
+
+    EXPECT_EQ(g_records[1].file_id_u8, CE_FILE_QUEUE_e);
+    EXPECT_EQ(g_records[1].line_u16, 456u);
+    EXPECT_EQ(g_records[1].arg_count_u8, 2u);
+    EXPECT_EQ(g_records[1].args_ua[0], 0xAABBCCDDu);
+    EXPECT_EQ(g_records[1].args_ua[1], 42u);
+}
+
+TEST(Logger, DropsNewestWhenFull) {
+    flush_ring();
+    uint32_t dropped_before = log_dropped();
+
+    // Default depth is 32 records; the 40 extra must be dropped, and the
+    // first 32 preserved in order.
+    for (uint16_t i = 0; i < 72; ++i) {
+        log_event(CE_FILE_DISPATCH_e, i);
+    }
+
+    EXPECT_EQ(log_dropped(), dropped_before + 40u);
+    EXPECT_EQ(log_drain(capture_formatter), 32u);
+    for (size_t i = 0; i < g_records.size(); ++i) {
+        EXPECT_EQ(g_records[i].line_u16, i);
+    }
+}
+
+TEST(Logger, TimestampHookStampsRecords) {
+    flush_ring();
+
+    log_set_timestamp_hook(fake_timestamp);
+    log_event(CE_FILE_DISPATCH_e, 1);
+    log_set_timestamp_hook(nullptr);
+    log_event(CE_FILE_DISPATCH_e, 2);
+
+    EXPECT_EQ(log_drain(capture_formatter), 2u);
+    ASSERT_EQ(g_records.size(), 2u);
+    EXPECT_EQ(g_records[0].timestamp_u32, 0xCAFE0000u);
+    EXPECT_EQ(g_records[1].timestamp_u32, 0u);
+}
+
+TEST(Logger, NullFormatterDrainsNothing) {
+    flush_ring();
+    log_event(CE_FILE_DISPATCH_e, 7);
+
+    EXPECT_EQ(log_drain(nullptr), 0u);
+    EXPECT_EQ(log_drain(capture_formatter), 1u);  // record still pending
+}
@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <cstring>
+
+extern "C" {
+#include "ce_out.h"
+}
+
+namespace {
+
+std::vector<uint8_t> sink_captured;
+size_t sink_limit = SIZE_MAX;
+
+size_t capture_sink(const uint8_t* data, size_t len) {
+    size_t take = (len < sink_limit) ? len : sink_limit;
+    sink_captured.insert(sink_captured.end(), data, data + take);
+    sink_limit -= take;
+    return take;
+}
+
+void flush_ring() {
+    sink_limit = SIZE_MAX;
+    (void)ce_out_drain(capture_sink);
+    sink_captured.clear();
+    sink_limit = SIZE_MAX;
+}
+
+}  // namespace
+
+TEST(Out, WriteThenDrainRoundTrips) {
+    flush_ring();
+
+    EXPECT_EQ(ce_out_write_str("OK 42\n"), 6u);
+    EXPECT_EQ(ce_out_pending(), 6u);
+
+    EXPECT_EQ(ce_out_drain(capture_sink), 6u);
+    EXPECT_EQ(std::string(sink_captured.begin(), sink_captured.end()), "OK 42\n");
+    EXPECT_EQ(ce_out_pending(), 0u);
+}
+
+TEST(Out, DropsOnlyWhatDoesNotFit) {
+    flush_ring();
+
+    // Default ring is 1024 bytes; a 1030-byte write keeps the first 1024.
+    std::vector<uint8_t> big(1030, 0xAB);
+    EXPECT_EQ(ce_out_write(big.data(), big.size()), 1024u);
+    EXPECT_EQ(ce_out_write_str("late"), 0u);  // full: nothing accepted
+
+    EXPECT_EQ(ce_out_drain(capture_sink), 1024u);
+    EXPECT_EQ(ce_out_pending(), 0u);
+}
+
+TEST(Out, DrainRespectsSinkBackPressure) {
+    flush_ring();
+
+    EXPECT_EQ(ce_out_write_str("abcdefgh"), 8u);
+
+    sink_limit = 3;
+    EXPECT_EQ(ce_out_drain(capture_sink), 3u);
+    EXPECT_EQ(ce_out_pending(), 5u);
+
+    sink_limit = SIZE_MAX;
+    EXPECT_EQ(ce_out_drain(capture_sink), 5u);
+    EXPECT_EQ(std::string(sink_captured.begin(), sink_captured.end()), "abcdefgh");
+}
+
+TEST(Out, WrapAroundPreservesByteOrder) {
+    flush_ring();
+
+    // Walk the indices close to the wrap point, then write across it.
+    std::vector<uint8_t> pad(1000, 0x00);
+    ASSERT_EQ(ce_out_write(pad.data(), pad.size()), 1000u);
+    flush_ring();
+
+    std::string msg = "wrap-around payload spanning the ring boundary";
+    EXPECT_EQ(ce_out_write_str(msg.c_str()), msg.size());
+    EXPECT_EQ(ce_out_drain(capture_sink), msg.size());
+    EXPECT_EQ(std::string(sink_captured.begin(), sink_captured.end()), msg);
+}
+
+TEST(Out, RejectsNullArguments) {
+    EXPECT_EQ(ce_out_write(nullptr, 4), 0u);
+    EXPECT_EQ(ce_out_write_str(nullptr), 0u);
+    EXPECT_EQ(ce_out_drain(nullptr), 0u);
+}
@@ -217,6 +217,43 @@ TEST(ParseI64Test, InvalidInputs) {
     EXPECT_FALSE(parse_i64("42", NULL));
 }
 
+//----------------------------------------------------------------------------//
+// hex prefix tests (all integer parsers share the 0x path)
+//----------------------------------------------------------------------------//
+
+TEST(ParseHexPrefixTest, ValidInputs) {
+    uint8_t u8;
+    uint16_t u16;
+    uint32_t u32;
+    uint64_t u64;
+    int32_t i32;
+    int64_t i64;
+
+    EXPECT_TRUE(parse_u8("0x0", &u8)); EXPECT_EQ(u8, 0u);
+    EXPECT_TRUE(parse_u8("0xFF", &u8)); EXPECT_EQ(u8, 255u);
+    EXPECT_TRUE(parse_u8("0Xff", &u8)); EXPECT_EQ(u8, 255u);
+    EXPECT_TRUE(parse_u16("0xFFFF", &u16)); EXPECT_EQ(u16, 0xFFFFu);
+    EXPECT_TRUE(parse_u32("0xDEADBEEF", &u32)); EXPECT_EQ(u32, 0xDEADBEEFu);
+    EXPECT_TRUE(parse_u64("0xFFFFFFFFFFFFFFFF", &u64)); EXPECT_EQ(u64, UINT64_MAX);
+    EXPECT_TRUE(parse_u64("0x00000000000000000001", &u64)); EXPECT_EQ(u64, 1u);
+    EXPECT_TRUE(parse_i32("0x7FFFFFFF", &i32)); EXPECT_EQ(i32, INT32_MAX);
+    EXPECT_TRUE(parse_i32("-0x80000000", &i32)); EXPECT_EQ(i32, INT32_MIN);
+    EXPECT_TRUE(parse_i64("-0x8000000000000000", &i64)); EXPECT_EQ(i64, INT64_MIN);
+}
+
+TEST(ParseHexPrefixTest, InvalidInputs) {
+    uint8_t u8;
+    uint32_t u32;
+    int32_t i32;
+
+    EXPECT_FALSE(parse_u8("0x", &u8));      // bare prefix
+    EXPECT_FALSE(parse_u8("0x100", &u8));   // UINT8_MAX + 1
+    EXPECT_FALSE(parse_u8("0xG1", &u8));    // non-hex digit
+    EXPECT_FALSE(parse_u32("0x100000000", &u32));  // UINT32_MAX + 1
+    EXPECT_FALSE(parse_i32("0x80000000", &i32));   // INT32_MAX + 1
+    EXPECT_FALSE(parse_i32("-0x80000001", &i32));  // INT32_MIN - 1
+}
+
 //----------------------------------------------------------------------------//
 // parse_boolean_token tests
 //----------------------------------------------------------------------------//
@@ -349,3 +386,24 @@ TEST(ParseHexStringTest, EdgeCases) {
     // Invalid characters with correct length
     EXPECT_FALSE(parse_hex_string("0G", out, 1, &out_len));
 }
+
+TEST(ParseHexStringTest, LengthVariant) {
+    uint8_t out[4] = {0};
+    size_t out_len = 0;
+
+    // Same semantics as parse_hex_string, length supplied by the caller
+    EXPECT_TRUE(parse_hex_string_n("01FF", 4u, out, 2, &out_len));
+    EXPECT_EQ(out_len, 2u);
+    EXPECT_EQ(out[0], 0x01);
+    EXPECT_EQ(out[1], 0xFF);
+
+    // Only the first `len` characters are decoded; no terminator needed
+    EXPECT_TRUE(parse_hex_string_n("AABBCC", 2u, out, 4, &out_len));
+    EXPECT_EQ(out_len, 1u);
+    EXPECT_EQ(out[0], 0xAA);
+
+    EXPECT_FALSE(parse_hex_string_n("01FF", 0u, out, 2, &out_len));  // empty slice
+    EXPECT_FALSE(parse_hex_string_n("01FF", 3u, out, 2, &out_len));  // odd length
+    EXPECT_FALSE(parse_hex_string_n("0G", 2u, out, 2, &out_len));    // invalid char
+    EXPECT_FALSE(parse_hex_string_n(NULL, 2u, out, 2, &out_len));    // null input
+}
@@ -0,0 +1,84 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <string>
+
+extern "C" {
+#include "ce_queue.h"
+#include "demo.h"
+}
+
+// The demo_* handler mocks are defined in test_dispatch.cpp (same binary);
+// these tests only verify queue mechanics, not handler side effects.
+
+TEST(Queue, SubmitThenDrainDispatches) {
+    EXPECT_TRUE(ce_queue_submit("cat_byte 5"));
+    EXPECT_TRUE(ce_queue_submit("void"));
+    EXPECT_EQ(ce_queue_pending(), 2u);
+    EXPECT_EQ(ce_queue_drain(), 2u);
+    EXPECT_EQ(ce_queue_pending(), 0u);
+}
+
+TEST(Queue, RejectsNullAndOversized) {
+    EXPECT_FALSE(ce_queue_submit(nullptr));
+    std::string huge(MAX_LINE_BUF_SIZE, 'x');
+    EXPECT_FALSE(ce_queue_submit(huge.c_str()));
+    EXPECT_EQ(ce_queue_pending(), 0u);
+}
+
+TEST(Queue, FullQueueDropsSubmission) {
+    size_t accepted = 0;
+    // Default depth is 16; oversubmit and count acceptances
+    for (int i = 0; i < 64; ++i) {
+        if (ce_queue_submit("void")) {
+            accepted++;
+        }
+    }
+    EXPECT_EQ(accepted, 16u);
+    EXPECT_EQ(ce_queue_drain(), 16u);
+}
+
+TEST(Queue, ConcurrentProducersLoseNothing) {
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 200;
+    std::vector<std::thread> producers;
+    std::vector<size_t> accepted(kProducers, 0);
+    size_t drained = 0;
+
+    std::thread consumer([&] {
+        // Drain until every producer is done and the queue is empty
+        size_t idle_laps = 0;
+        while (idle_laps < 1000) {
+            size_t n = ce_queue_drain();
+            drained += n;
+            idle_laps = (n == 0) ? idle_laps + 1 : 0;
+            std::this_thread::yield();
+        }
+    });
+
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                if (ce_queue_submit("void")) {
+                    accepted[p]++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto &t : producers) {
+        t.join();
+    }
+    consumer.join();
+    drained += ce_queue_drain();
+
+    size_t total_accepted = 0;
+    for (size_t a : accepted) {
+        total_accepted += a;
+    }
+    EXPECT_EQ(drained, total_accepted);
+}
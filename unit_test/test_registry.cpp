@@ -0,0 +1,173 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+
+extern "C" {
+#include "ce_dispatch.h"
+#include "ce_frame.h"
+#include "ce_hash.h"
+#include "ce_table.h"
+
+/* UNIT_TEST-only helper from ce_table_registry.c */
+void _test_table_registry_reset(void);
+}
+
+// -----------------------------------------------------------------------------
+// Mock module table
+//
+// A small "firmware module" command set that is NOT part of the generated
+// table: mod_ping (no args) and mod_blink (one uint8). Registered tables
+// supply their own fused exec functions, as module codegen would.
+// -----------------------------------------------------------------------------
+
+static int g_ping_calls = 0;
+static uint8_t g_blink_arg = 0xFF;
+
+static bool exec_mod_ping(char* tokens_apc[]) {
+    (void)tokens_apc;
+    g_ping_calls++;
+    return true;
+}
+
+static bool exec_mod_blink(char* tokens_apc[]) {
+    // Minimal parse: single decimal digit is enough for the test input.
+    if (tokens_apc[1] == nullptr) {
+        return false;
+    }
+    g_blink_arg = static_cast<uint8_t>(tokens_apc[1][0] - '0');
+    return true;
+}
+
+static const ce_arg_type_et mod_blink_types[] = { TYPE_UINT8_e };
+
+// Static storage: the dispatcher's lookup cache may keep pointers into a
+// registered table across tests, so the table must outlive each fixture.
+static ce_signature_st module_table[2];
+
+class TableRegistry : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _test_table_registry_reset();
+        g_ping_calls = 0;
+        g_blink_arg = 0xFF;
+
+        module_table[0] = {
+            ce_hash_calculate("mod_ping"), nullptr, exec_mod_ping, nullptr, 0u
+        };
+        module_table[1] = {
+            ce_hash_calculate("mod_blink"), nullptr, exec_mod_blink, mod_blink_types, 1u
+        };
+        // The registry requires strictly ascending hashes, like the generator
+        // guarantees for its own output.
+        std::sort(module_table, module_table + 2,
+                  [](const ce_signature_st& a, const ce_signature_st& b) {
+                      return a.hash_u32 < b.hash_u32;
+                  });
+    }
+};
+
+TEST_F(TableRegistry, ResolvesRegisteredHashes) {
+    ASSERT_TRUE(ce_table_register(module_table, 2u));
+
+    const ce_signature_st* ping = ce_table_resolve_hash(ce_hash_calculate("mod_ping"));
+    ASSERT_NE(ping, nullptr);
+    EXPECT_EQ(ping->exec_fn, exec_mod_ping);
+
+    const ce_signature_st* blink = ce_table_resolve_hash(ce_hash_calculate("mod_blink"));
+    ASSERT_NE(blink, nullptr);
+    EXPECT_EQ(blink->exec_fn, exec_mod_blink);
+
+
+    EXPECT_EQ(ce_table_resolve_hash(0xDEADBEEFu), nullptr);
+}
+
+TEST_F(TableRegistry, PrimaryTableStillResolves) {
+    ASSERT_TRUE(ce_table_register(module_table, 2u));
+
+    const ce_signature_st* sig = ce_table_resolve_hash(ce_hash_calculate("cat_byte"));
+    ASSERT_NE(sig, nullptr);
+    // Primary entries resolve from the generated table, not the module one.
+    EXPECT_TRUE(sig >= ce_table_get_signatures() &&
+                sig < ce_table_get_signatures() + ce_table_get_signatures_count());
+}
+
+TEST_F(TableRegistry, DispatchesRegisteredCommandEndToEnd) {
+    ASSERT_TRUE(ce_table_register(module_table, 2u));
+
+    EXPECT_TRUE(ce_dispatch_from_line("mod_ping"));
+    EXPECT_EQ(g_ping_calls, 1);
+
+    EXPECT_TRUE(ce_dispatch_from_line("mod_blink 7"));
+    EXPECT_EQ(g_blink_arg, 7u);
+
+    // Argument-count validation applies to registered commands too.
+    EXPECT_FALSE(ce_dispatch_from_line("mod_blink"));
+}
+
+TEST_F(TableRegistry, StatusEntryPointRunsRegisteredCommands) {
+    ASSERT_TRUE(ce_table_register(module_table, 2u));
+
+    EXPECT_EQ(ce_dispatch_from_line_status("mod_ping", nullptr), CE_STATUS_OK_e);
+    EXPECT_EQ(g_ping_calls, 1);
+
+    EXPECT_EQ(ce_dispatch_from_line_status("mod_blink 7", nullptr), CE_STATUS_OK_e);
+    EXPECT_EQ(g_blink_arg, 7u);
+
+    // Failure causes stay precise for registered commands too.
+    EXPECT_EQ(ce_dispatch_from_line_status("mod_blink", nullptr), CE_STATUS_ARG_COUNT_e);
+    EXPECT_EQ(ce_dispatch_from_line_status("mod_blink zz", nullptr), CE_STATUS_PARSE_FAIL_e);
+}
+
+TEST_F(TableRegistry, TwoPhaseInvokesRegisteredCommands) {
+    ASSERT_TRUE(ce_table_register(module_table, 2u));
+
+    // Static: the parsed object embeds the full line and blob buffers.
+    static ce_parsed_cmd_st cmd;
+    ASSERT_TRUE(ce_parse_line("mod_blink 7", &cmd));
+
+    EXPECT_TRUE(ce_invoke_parsed(&cmd));
+    EXPECT_EQ(g_blink_arg, 7u);
+
+    // Replay works repeatedly from the stored token view.
+    g_blink_arg = 0xFF;
+    EXPECT_TRUE(ce_invoke_parsed(&cmd));
+    EXPECT_EQ(g_blink_arg, 7u);
+}
+
+TEST_F(TableRegistry, FrameRejectsRegisteredCommands) {
+    ASSERT_TRUE(ce_table_register(module_table, 2u));
+
+    // Registered signatures only carry the text-token exec entry, so the
+    // binary wire path must reject them up front rather than decode
+    // arguments it cannot deliver.
+    uint32_t hash = ce_hash_calculate("mod_ping");
+    uint8_t frame[4] = {
+        static_cast<uint8_t>(hash & 0xFFu),
+        static_cast<uint8_t>((hash >> 8) & 0xFFu),
+        static_cast<uint8_t>((hash >> 16) & 0xFFu),
+        static_cast<uint8_t>((hash >> 24) & 0xFFu),
+    };
+    EXPECT_FALSE(ce_dispatch_from_frame(frame, sizeof(frame)));
+    EXPECT_EQ(g_ping_calls, 0);
+}
+
+TEST_F(TableRegistry, RejectsInvalidTables) {
+    EXPECT_FALSE(ce_table_register(nullptr, 1u));
+    EXPECT_FALSE(ce_table_register(module_table, 0u));
+
+    ce_signature_st unsorted[2] = { module_table[1], module_table[0] };
+    EXPECT_FALSE(ce_table_register(unsorted, 2u));
+
+    // Duplicate hashes violate the strictly-ascending invariant.
+    ce_signature_st duplicated[2] = { module_table[0], module_table[0] };
+    EXPECT_FALSE(ce_table_register(duplicated, 2u));
+}
+
+TEST_F(TableRegistry, EnforcesFixedCapacity) {
+    // Default CE_TABLE_REGISTRY_SIZE is 4 slots.
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ce_table_register(&module_table[0], 1u));
+    }
+    EXPECT_FALSE(ce_table_register(&module_table[0], 1u));
+}
@@ -0,0 +1,110 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ce_types.h"
+#include "ce_dispatch.h"
+#include "ce_scheduler.h"
+
+void _test_scheduler_reset(void);
+}
+
+// ---------------------------------------------------------------------------
+// Mock long-running handler (referenced by the generated table)
+// ---------------------------------------------------------------------------
+
+// Remaining slices after the inline first slice; each resume consumes one.
+static uint8_t g_slow_work_remaining = 0u;
+static int g_slow_work_calls = 0;
+static int g_slow_work_resume_calls = 0;
+static bool g_slow_work_fail_on_resume = false;
+
+extern "C" ce_long_status_et demo_slow_work(uint8_t slices) {
+    g_slow_work_calls++;
+    if (0u == slices) {
+        return CE_LONG_DONE_e;
+    }
+    g_slow_work_remaining = slices;
+    return CE_LONG_CONTINUE_e;
+}
+
+extern "C" ce_long_status_et demo_slow_work_resume(void) {
+    g_slow_work_resume_calls++;
+    if (g_slow_work_fail_on_resume) {
+        return CE_LONG_FAIL_e;
+    }
+    if (g_slow_work_remaining > 0u) {
+        g_slow_work_remaining--;
+    }
+    return (0u == g_slow_work_remaining) ? CE_LONG_DONE_e : CE_LONG_CONTINUE_e;
+}
+
+namespace {
+
+ce_long_status_et always_continue(void) {
+    return CE_LONG_CONTINUE_e;
+}
+
+}  // namespace
+
+class Scheduler : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _test_scheduler_reset();
+        g_slow_work_remaining = 0u;
+        g_slow_work_calls = 0;
+        g_slow_work_resume_calls = 0;
+        g_slow_work_fail_on_resume = false;
+    }
+};
+
+TEST_F(Scheduler, ShortFirstSliceCompletesWithoutDeferring) {
+    EXPECT_TRUE(ce_dispatch_from_line("slow_work 0"));
+    EXPECT_EQ(g_slow_work_calls, 1);
+    EXPECT_EQ(ce_scheduler_pending(), 0u);
+}
+
+TEST_F(Scheduler, ContinuingCommandIsDeferredAndTicksToCompletion) {
+    EXPECT_TRUE(ce_dispatch_from_line("slow_work 2"));
+    EXPECT_EQ(ce_scheduler_pending(), 1u);
+
+    // First tick consumes one slice; one remains pending.
+    EXPECT_EQ(ce_scheduler_tick(), 1u);
+    EXPECT_EQ(g_slow_work_resume_calls, 1);
+
+    // Second tick finishes and retires the slot.
+    EXPECT_EQ(ce_scheduler_tick(), 0u);
+    EXPECT_EQ(g_slow_work_resume_calls, 2);
+    EXPECT_EQ(ce_scheduler_pending(), 0u);
+}
+
+TEST_F(Scheduler, FailingResumeRetiresTheSlot) {
+    EXPECT_TRUE(ce_dispatch_from_line("slow_work 3"));
+    g_slow_work_fail_on_resume = true;
+
+    EXPECT_EQ(ce_scheduler_tick(), 0u);
+    EXPECT_EQ(ce_scheduler_pending(), 0u);
+
+    // Subsequent ticks do not call the retired resume function again.
+    EXPECT_EQ(ce_scheduler_tick(), 0u);
+    EXPECT_EQ(g_slow_work_resume_calls, 1);
+}
+
+TEST_F(Scheduler, DeferRejectsNullResumeFunction) {
+    EXPECT_FALSE(ce_scheduler_defer(nullptr));
+    EXPECT_EQ(ce_scheduler_pending(), 0u);
+}
+
+TEST_F(Scheduler, DeferFailsWhenAllSlotsAreOccupied) {
+    // CE_SCHEDULER_SLOTS defaults to 4 in test builds.
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ce_scheduler_defer(always_continue));
+    }
+    EXPECT_FALSE(ce_scheduler_defer(always_continue));
+    EXPECT_EQ(ce_scheduler_pending(), 4u);
+}
+
+TEST_F(Scheduler, TickIsSilentWithNothingPending) {
+    EXPECT_EQ(ce_scheduler_tick(), 0u);
+}
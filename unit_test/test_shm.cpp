@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+#include <string>
+
+extern "C" {
+#include "ce_types.h"
+#include "ce_shm.h"
+}
+
+namespace {
+
+constexpr const char* kChannelName = "/cevo-test-cmd";
+
+}  // namespace
+
+class ShmChannel : public ::testing::Test {
+protected:
+    void SetUp() override { ce_shm_channel_close(); }
+    void TearDown() override { ce_shm_channel_close(); }
+};
+
+TEST_F(ShmChannel, CreateRejectsInvalidArguments) {
+    EXPECT_FALSE(ce_shm_channel_create(nullptr, 8u));
+    EXPECT_FALSE(ce_shm_channel_create("no-leading-slash", 8u));
+    EXPECT_FALSE(ce_shm_channel_create(kChannelName, 0u));
+    EXPECT_FALSE(ce_shm_channel_create(kChannelName, 6u));  // not a power of two
+}
+
+TEST_F(ShmChannel, CreateRejectsDoubleMapping) {
+    ASSERT_TRUE(ce_shm_channel_create(kChannelName, 8u));
+    EXPECT_FALSE(ce_shm_channel_create(kChannelName, 8u));
+}
+
+TEST_F(ShmChannel, OpenFailsWithoutCreator) {
+    EXPECT_FALSE(ce_shm_channel_open("/cevo-test-nonexistent"));
+}
+
+TEST_F(ShmChannel, SubmitWithoutChannelIsRejected) {
+    EXPECT_FALSE(ce_shm_submit("void"));
+    EXPECT_EQ(ce_shm_drain(), 0u);
+    EXPECT_EQ(ce_shm_pending(), 0u);
+}
+
+TEST_F(ShmChannel, SubmittedLinesDrainThroughDispatch) {
+    ASSERT_TRUE(ce_shm_channel_create(kChannelName, 8u));
+
+    EXPECT_TRUE(ce_shm_submit("void"));
+    EXPECT_TRUE(ce_shm_submit("cat_byte 42"));
+    EXPECT_EQ(ce_shm_pending(), 2u);
+
+    EXPECT_EQ(ce_shm_drain(), 2u);
+    EXPECT_EQ(ce_shm_pending(), 0u);
+}
+
+TEST_F(ShmChannel, SubmitRejectsNullAndOversizedLines) {
+    ASSERT_TRUE(ce_shm_channel_create(kChannelName, 8u));
+
+    EXPECT_FALSE(ce_shm_submit(nullptr));
+
+    std::string huge(MAX_LINE_BUF_SIZE, 'a');
+    EXPECT_FALSE(ce_shm_submit(huge.c_str()));
+    EXPECT_EQ(ce_shm_pending(), 0u);
+}
+
+TEST_F(ShmChannel, FullRingDropsAndRecoversAfterDrain) {
+    ASSERT_TRUE(ce_shm_channel_create(kChannelName, 4u));
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ce_shm_submit("void"));
+    }
+    EXPECT_FALSE(ce_shm_submit("void"));  // ring full
+
+    EXPECT_EQ(ce_shm_drain(), 4u);
+    EXPECT_TRUE(ce_shm_submit("void"));  // slots recycled
+    EXPECT_EQ(ce_shm_drain(), 1u);
+}
+
+TEST_F(ShmChannel, RingWrapsAcrossManyLaps) {
+    ASSERT_TRUE(ce_shm_channel_create(kChannelName, 4u));
+
+    for (int lap = 0; lap < 10; ++lap) {
+        EXPECT_TRUE(ce_shm_submit("void"));
+        EXPECT_TRUE(ce_shm_submit("cat_byte 7"));
+        EXPECT_EQ(ce_shm_drain(), 2u);
+    }
+    EXPECT_EQ(ce_shm_pending(), 0u);
+}
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#ifndef CE_STATS_ENABLE
+#define CE_STATS_ENABLE
+#endif
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ce_dispatch.h"
+#include "ce_stats.h"
+#include "ce_table.h"
+#include "ce_hash.h"
+#include "ce_command_ids.h"
+}
+
+// The demo_* handler mocks are defined in test_dispatch.cpp (same binary).
+
+static size_t index_of(const char* name) {
+    const ce_signature_st* sig = ce_table_lookup_hash(ce_hash_calculate(name));
+    return static_cast<size_t>(sig - ce_table_get_signatures());
+}
+
+static uint32_t fake_clock = 0;
+extern "C" uint32_t test_timestamp(void) { return fake_clock; }
+
+TEST(Stats, CountsDispatchesPerCommand) {
+    ce_stats_reset();
+    EXPECT_TRUE(ce_dispatch_from_line("cat_byte 1"));
+    EXPECT_TRUE(ce_dispatch_from_line("cat_byte 2"));
+    EXPECT_TRUE(ce_dispatch_from_line("void"));
+
+    ce_stats_entry_st snap[CE_CMD_COUNT] = {};
+    ASSERT_EQ(ce_stats_snapshot(snap, CE_CMD_COUNT), (size_t)CE_CMD_COUNT);
+    EXPECT_EQ(snap[index_of("cat_byte")].dispatch_count_u32, 2u);
+    EXPECT_EQ(snap[index_of("void")].dispatch_count_u32, 1u);
+}
+
+TEST(Stats, CountsParseFailures) {
+    ce_stats_reset();
+    EXPECT_FALSE(ce_dispatch_from_line("cat_byte not_a_number"));
+
+    ce_stats_entry_st snap[CE_CMD_COUNT] = {};
+    ce_stats_snapshot(snap, CE_CMD_COUNT);
+    EXPECT_EQ(snap[index_of("cat_byte")].parse_fail_count_u32, 1u);
+    EXPECT_EQ(snap[index_of("cat_byte")].dispatch_count_u32, 0u);
+}
+
+TEST(Stats, AccumulatesHandlerCyclesViaHook) {
+    ce_stats_reset();
+    ce_stats_set_timestamp_hook(test_timestamp);
+
+    fake_clock = 100;  // handler "runs" for 0 ticks but both reads happen
+    EXPECT_TRUE(ce_dispatch_from_line("void"));
+
+    ce_stats_entry_st snap[CE_CMD_COUNT] = {};
+    ce_stats_snapshot(snap, CE_CMD_COUNT);
+    EXPECT_EQ(snap[index_of("void")].handler_cycles_u64, 0u);
+
+    ce_stats_set_timestamp_hook(nullptr);
+}
+
+TEST(Stats, ResetClearsCounters) {
+    EXPECT_TRUE(ce_dispatch_from_line("void"));
+    ce_stats_reset();
+
+    ce_stats_entry_st snap[CE_CMD_COUNT] = {};
+    ce_stats_snapshot(snap, CE_CMD_COUNT);
+    for (size_t i = 0; i < CE_CMD_COUNT; ++i) {
+        EXPECT_EQ(snap[i].dispatch_count_u32, 0u);
+        EXPECT_EQ(snap[i].parse_fail_count_u32, 0u);
+    }
+}
@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "ce_types.h"
+#include "ce_stream.h"
+}
+
+namespace {
+
+// Convenience wrapper: feed a string as raw bytes.
+size_t feed(const std::string& bytes) {
+    return ce_feed(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+}
+
+}  // namespace
+
+class StreamFeed : public ::testing::Test {
+protected:
+    void SetUp() override { ce_feed_reset(); }
+};
+
+TEST_F(StreamFeed, DispatchesOnlyWhenTerminatorArrives) {
+    EXPECT_EQ(feed("void"), 0u);   // complete command, no terminator yet
+    EXPECT_EQ(feed("\n"), 1u);
+}
+
+TEST_F(StreamFeed, ReassemblesLinesSplitAcrossChunks) {
+    // DMA-style delivery: chunk boundaries fall inside tokens.
+    EXPECT_EQ(feed("cat_b"), 0u);
+    EXPECT_EQ(feed("yte 2"), 0u);
+    EXPECT_EQ(feed("2\n"), 1u);
+}
+
+TEST_F(StreamFeed, DispatchesMultipleLinesPerChunk) {
+    EXPECT_EQ(feed("void\ncat_byte 5\n\nvoid\n"), 3u);
+}
+
+TEST_F(StreamFeed, BlankAndWhitespaceLinesAreSilent) {
+    EXPECT_EQ(feed("\r\n \t\n\n"), 0u);
+}
+
+TEST_F(StreamFeed, UnknownCommandCountsAsFailure) {
+    EXPECT_EQ(feed("bogus_cmd 1\nvoid\n"), 1u);
+}
+
+TEST_F(StreamFeed, OversizedLineIsDroppedAndStreamResynchronizes) {
+    std::string huge(MAX_LINE_BUF_SIZE + 40u, 'a');
+    EXPECT_EQ(feed(huge), 0u);
+    EXPECT_EQ(feed("\nvoid\n"), 1u);  // terminator resynchronizes
+}
+
+TEST_F(StreamFeed, TokenOverflowIsDroppedAndStreamResynchronizes) {
+    std::string line;
+    for (size_t i = 0; i <= MAX_TOKENS; ++i) {
+        line += "tok ";
+    }
+    EXPECT_EQ(feed(line + "\nvoid\n"), 1u);
+}
+
+TEST_F(StreamFeed, ResetDropsPartialLine) {
+    EXPECT_EQ(feed("cat_byte"), 0u);
+    ce_feed_reset();
+    // The leftover "cat_byte" must not prefix the next line.
+    EXPECT_EQ(feed(" 22\n"), 0u);
+    EXPECT_EQ(feed("void\n"), 1u);
+}
+
+TEST_F(StreamFeed, NullChunkIsRejected) {
+    EXPECT_EQ(ce_feed(nullptr, 4u), 0u);
+}